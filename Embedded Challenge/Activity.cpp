@@ -0,0 +1,143 @@
+#include "Activity.h" // Include the header file for the activity classifier
+
+// Integer square root (floor) of a 64-bit value
+static uint32_t ISqrt(uint64_t value)
+{
+    uint64_t root = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    while (bit > value)
+        bit >>= 2;
+    while (bit != 0)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
+
+// Convert rad/s to Q8, saturating at 8 rad/s so the window sums fit in 32 bits
+static int32_t ToFixed(float value)
+{
+    float scaled = value * ACTIVITY_ONE;
+    if (scaled > 2047)
+        return 2047;
+    if (scaled < -2047)
+        return -2047;
+    return (int32_t)scaled;
+}
+
+Activity::Activity()
+{
+    Reset();
+}
+
+// Forget all sums and return to ACTIVITY_STILL
+void Activity::Reset()
+{
+    for (int i = 0; i < 2; i++)
+    {
+        halves[i] = HalfWindow();
+    }
+    current_half = 0;
+    count = 0;
+    swing_sign = 0;
+    features = ActivityFeatures();
+    current = ACTIVITY_STILL;
+}
+
+// Add one sample to the running sums; classify when a half window completes
+bool Activity::Update(const float *gyro_xyz, float dominant_hz)
+{
+    int32_t x = ToFixed(gyro_xyz[0]);
+    int32_t y = ToFixed(gyro_xyz[1]);
+    int32_t z = ToFixed(gyro_xyz[2]);
+
+    HalfWindow &half = halves[current_half];
+    half.sum_x += x;
+    half.sum_z += z;
+    half.sum_xx += x * x;
+    half.sum_zz += z * z;
+    half.sum_xz += x * z;
+    half.sum_all += x * x + y * y + z * z;
+
+    // Count swing reversals, ignoring wobble inside the hysteresis band
+    int sign = x > ACTIVITY_ZC_HYST ? 1 : (x < -ACTIVITY_ZC_HYST ? -1 : 0);
+    if (sign != 0 && sign != swing_sign)
+    {
+        if (swing_sign != 0)
+            half.crossings++;
+        swing_sign = sign;
+    }
+
+    if (++count < ACTIVITY_HALF)
+        return false;
+
+    Classify(ToFixed(dominant_hz));
+
+    // The finished half becomes the previous one; start filling the other
+    count = 0;
+    current_half ^= 1;
+    halves[current_half] = HalfWindow();
+    return true;
+}
+
+// Combine both halves into window features and run the decision tree
+void Activity::Classify(int32_t frequency)
+{
+    const HalfWindow &a = halves[0];
+    const HalfWindow &b = halves[1];
+    int64_t n = 2 * ACTIVITY_HALF;
+    int64_t sum_x = a.sum_x + b.sum_x;
+    int64_t sum_z = a.sum_z + b.sum_z;
+    int64_t sum_xx = a.sum_xx + b.sum_xx;
+    int64_t sum_zz = a.sum_zz + b.sum_zz;
+    int64_t sum_xz = a.sum_xz + b.sum_xz;
+
+    features.rms_all = ISqrt((a.sum_all + b.sum_all) / n);
+    features.rms_swing = ISqrt(sum_xx / n);
+    features.rms_yaw = ISqrt(sum_zz / n);
+    features.zero_crossings = a.crossings + b.crossings;
+    features.frequency = frequency;
+
+    // Pearson correlation in Q8: n*Sxy - Sx*Sy over the product of the deviations
+    int64_t var_x = n * sum_xx - sum_x * sum_x;
+    int64_t var_z = n * sum_zz - sum_z * sum_z;
+    int64_t deviation = (int64_t)ISqrt(var_x) * ISqrt(var_z);
+    features.correlation = deviation > 0 ? (int32_t)(((n * sum_xz - sum_x * sum_z) * ACTIVITY_ONE) / deviation) : 0;
+
+    // Decision tree
+    if (features.rms_all < ACTIVITY_STILL_RMS)
+    {
+        current = ACTIVITY_STILL;
+    }
+    else if (features.rms_swing > ACTIVITY_RUN_RMS &&
+             (features.frequency > ACTIVITY_RUN_FREQ || (features.frequency == 0 && features.zero_crossings > ACTIVITY_RUN_ZC)))
+    {
+        current = ACTIVITY_RUN;
+    }
+    else if ((features.correlation > ACTIVITY_STAIRS_COR || features.correlation < -ACTIVITY_STAIRS_COR) &&
+             2 * features.rms_yaw > features.rms_swing)
+    {
+        // Climbing lifts the knee, turning the leg strongly about both axes at once
+        current = ACTIVITY_STAIRS;
+    }
+    else
+    {
+        current = ACTIVITY_WALK;
+    }
+}
+
+// Short display name of an activity
+const char *Activity::Name(ActivityType type)
+{
+    static const char *const names[ACTIVITY_COUNT] = {"Still", "Walk", "Run", "Stairs"};
+    return type < ACTIVITY_COUNT ? names[type] : "?";
+}
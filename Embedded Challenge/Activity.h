@@ -0,0 +1,91 @@
+#ifndef __ACTIVITY_H
+#define __ACTIVITY_H
+
+#include <stdint.h>
+
+/* Activity window: two halves of ACTIVITY_HALF samples, classified after every half */
+#define ACTIVITY_HALF       25
+
+/* Fixed-point format of samples and features: Q8 (1/256 rad/s, 1/256 Hz) */
+#define ACTIVITY_Q          8
+#define ACTIVITY_ONE        (1 << ACTIVITY_Q)
+
+/* Decision tree thresholds (Q8) */
+#define ACTIVITY_ZC_HYST    51   // 0.2 rad/s hysteresis for swing zero crossings
+#define ACTIVITY_STILL_RMS  38   // 0.15 rad/s overall RMS: below is standing still
+#define ACTIVITY_RUN_RMS    640  // 2.5 rad/s swing RMS: above (and fast) is running
+#define ACTIVITY_RUN_FREQ   333  // 1.3 Hz stride frequency: above (and strong) is running
+#define ACTIVITY_RUN_ZC     3    // Swing reversals per window standing in for the frequency before the first FFT frame
+#define ACTIVITY_STAIRS_COR 154  // 0.6 swing/yaw correlation: above (with strong yaw) is climbing stairs
+
+typedef enum
+{
+    ACTIVITY_STILL,
+    ACTIVITY_WALK,
+    ACTIVITY_RUN,
+    ACTIVITY_STAIRS,
+    ACTIVITY_COUNT
+} ActivityType;
+
+/* Features of one window, all in Q8 except the crossing count */
+typedef struct
+{
+    int32_t rms_all;        // RMS over all three axes
+    int32_t rms_swing;      // RMS of the swing (X) axis
+    int32_t rms_yaw;        // RMS of the yaw (Z) axis
+    int32_t correlation;    // Correlation of swing (X) and yaw (Z), -256..256
+    int32_t zero_crossings; // Swing direction reversals
+    int32_t frequency;      // Dominant frequency in Hz
+} ActivityFeatures;
+
+/*
+  Lightweight activity classifier (still / walk / run / stairs).
+
+  Features are accumulated incrementally in fixed point: every sample adds a
+  handful of integer products to the running sums of the current half window,
+  and each completed half is combined with the previous one into a one-second
+  window. A small decision tree then picks the activity, so classification
+  costs a few integer operations per sample plus a few square roots per window.
+*/
+class Activity
+{
+public:
+    Activity();
+
+    // Forget all sums and return to ACTIVITY_STILL
+    void Reset();
+
+    // Add one gyro sample (rad/s). When a half window completes, the window is
+    // classified using the given dominant frequency (Hz) and true is returned.
+    bool Update(const float *gyro_xyz, float dominant_hz);
+
+    // Most recent classification
+    ActivityType Current() const { return current; }
+
+    // Features of the most recent classification
+    const ActivityFeatures &Features() const { return features; }
+
+    // Short display name of an activity
+    static const char *Name(ActivityType type);
+
+private:
+    struct HalfWindow
+    {
+        int32_t sum_x, sum_z;   // Sums of the swing and yaw samples
+        int32_t sum_xx, sum_zz; // Sums of squares
+        int32_t sum_xz;         // Sum of products
+        int32_t sum_all;        // Sum of squares over all axes
+        int32_t crossings;      // Swing direction reversals
+    };
+
+    void Classify(int32_t frequency);
+
+    HalfWindow halves[2];   // Previous and current half window
+    int current_half;       // Index of the half being filled
+    int count;              // Samples in the current half
+    int swing_sign;         // Last swing direction outside the hysteresis band
+    ActivityFeatures features;
+    ActivityType current;
+};
+
+#endif
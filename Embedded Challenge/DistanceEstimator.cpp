@@ -0,0 +1,90 @@
+#include <mbed.h>
+#include "DistanceEstimator.h" // Include the header file for the distance estimators
+
+EstimatorRegistry::EstimatorRegistry() : count(0)
+{
+    // Start the DWT cycle counter used for the CPU-time accounting
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    Reset();
+}
+
+// Register an estimator; returns false when the registry is full
+bool EstimatorRegistry::Add(DistanceEstimator *estimator)
+{
+    if (count >= ESTIMATOR_MAX)
+        return false;
+    estimators[count] = estimator;
+    cycles[count] = 0;
+    count++;
+    return true;
+}
+
+// Reset all estimators and their cycle counts
+void EstimatorRegistry::Reset()
+{
+    for (int i = 0; i < count; i++)
+    {
+        estimators[i]->Reset();
+        cycles[i] = 0;
+    }
+    frames = 0;
+}
+
+// Pass one frame to every estimator, timing each call
+void EstimatorRegistry::Update(const PipelineSample &frame)
+{
+    for (int i = 0; i < count; i++)
+    {
+        uint32_t start = DWT->CYCCNT;
+        estimators[i]->Update(frame);
+        cycles[i] += (uint32_t)(DWT->CYCCNT - start); // Unsigned difference survives the counter wrapping
+    }
+    frames++;
+}
+
+// Pass one display tick to every estimator; its cycles count towards the frames of the tick
+void EstimatorRegistry::UpdateTick(const PipelineSample &tick)
+{
+    for (int i = 0; i < count; i++)
+    {
+        uint32_t start = DWT->CYCCNT;
+        estimators[i]->UpdateTick(tick);
+        cycles[i] += (uint32_t)(DWT->CYCCNT - start);
+    }
+}
+
+LegacyEstimator::LegacyEstimator(const float *activity_scale, int models, float offset)
+{
+    chain.Get<DistanceStage>().SetModels(activity_scale, models);
+    chain.Get<DistanceStage>().SetOffset(offset);
+    Reset();
+}
+
+// Run the tick through a copy of the firmware's velocity and distance stages
+void LegacyEstimator::UpdateTick(const PipelineSample &tick)
+{
+    PipelineSample sample = tick;
+    chain.Process(sample);
+}
+
+// Count the steps flagged in the frame stream
+void StepEstimator::Update(const PipelineSample &frame)
+{
+    if (frame.step)
+        steps++;
+}
+
+// Integrate the swing rate into the total angle swept by the leg
+void IntegrationEstimator::Update(const PipelineSample &frame)
+{
+    float rate = frame.gyro[0] < 0 ? -frame.gyro[0] : frame.gyro[0];
+    angle += rate * frame.dt;
+}
+
+// Over one stride the leg sweeps its swing angle forward and back while the body
+// advances two steps of about leg length x swing angle each
+float IntegrationEstimator::Distance() const
+{
+    return ESTIMATOR_LEG_LENGTH * angle;
+}
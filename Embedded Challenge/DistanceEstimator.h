@@ -0,0 +1,118 @@
+#ifndef __DISTANCE_ESTIMATOR_H
+#define __DISTANCE_ESTIMATOR_H
+
+#include <stdint.h>
+#include "PipelineStages.h"
+
+/* Estimator constants */
+#define ESTIMATOR_MAX         4     // Estimators a registry can hold
+#define ESTIMATOR_STEP_LENGTH 0.75f // Stride of the step-based estimator in metres
+#define ESTIMATOR_LEG_LENGTH  0.9f  // Hip-to-foot length of the integration-based estimator in metres
+
+/*
+  A distance algorithm fed with the processed frame stream: one frame per gyro
+  sample after the noise deadband, carrying the sample, the step flag and the
+  classified activity. Algorithms working on the half-second display ticks
+  take the tick frames instead, after the Hampel filter and idle handling.
+*/
+class DistanceEstimator
+{
+public:
+    virtual ~DistanceEstimator() {}
+
+    // Short name shown in comparisons
+    virtual const char *Name() const = 0;
+
+    // Start a new session
+    virtual void Reset() = 0;
+
+    // Process one frame
+    virtual void Update(const PipelineSample &frame) = 0;
+
+    // Process one display tick, as passed to the firmware's tick pipeline
+    virtual void UpdateTick(const PipelineSample &) {}
+
+    // Distance of the session so far, m
+    virtual float Distance() const = 0;
+};
+
+/*
+  Fans every frame out to all registered estimators in one acquisition pass
+  and accounts the CPU cycles each of them spends, measured with the DWT cycle
+  counter, so their accuracy can be weighed against their cost on real data.
+*/
+class EstimatorRegistry
+{
+public:
+    EstimatorRegistry();
+
+    // Register an estimator; returns false when the registry is full
+    bool Add(DistanceEstimator *estimator);
+
+    // Reset all estimators and their cycle counts
+    void Reset();
+
+    // Pass one frame to every estimator
+    void Update(const PipelineSample &frame);
+
+    // Pass one display tick to every estimator
+    void UpdateTick(const PipelineSample &tick);
+
+    int Count() const { return count; }
+    DistanceEstimator &Get(int i) { return *estimators[i]; }
+
+    // Average CPU cycles estimator i spent per frame since the last Reset()
+    uint32_t CyclesPerFrame(int i) const { return frames ? (uint32_t)(cycles[i] / frames) : 0; }
+
+private:
+    DistanceEstimator *estimators[ESTIMATOR_MAX];
+    uint64_t cycles[ESTIMATOR_MAX]; // Cycles spent per estimator
+    uint32_t frames;                // Frames processed since the last Reset()
+    int count;
+};
+
+/* The original method: tick-rate velocity differences converted with the activity's distance model,
+   on the same tick frames as the distance shown on screen */
+class LegacyEstimator : public DistanceEstimator
+{
+public:
+    // activity_scale[activity]: raw distance per metre (see DistanceStage)
+    LegacyEstimator(const float *activity_scale, int models, float offset);
+
+    const char *Name() const { return "Legacy"; }
+    void Reset() { chain.Reset(); }
+    void Update(const PipelineSample &) {}
+    void UpdateTick(const PipelineSample &tick);
+    float Distance() const { return chain.Get<DistanceStage>().Distance(); }
+
+private:
+    Pipeline<VelocityStage, DistanceStage> chain;
+};
+
+/* Step counting: a fixed stride per detected step */
+class StepEstimator : public DistanceEstimator
+{
+public:
+    const char *Name() const { return "Steps"; }
+    void Reset() { steps = 0; }
+    void Update(const PipelineSample &frame);
+    float Distance() const { return steps * ESTIMATOR_STEP_LENGTH; }
+
+private:
+    int steps;
+};
+
+/* Swing integration: foot travel of a pendulum leg from the integrated swing angle */
+class IntegrationEstimator : public DistanceEstimator
+{
+public:
+    const char *Name() const { return "Integrate"; }
+    void Reset() { angle = 0; }
+    void Update(const PipelineSample &frame);
+    float Distance() const;
+
+private:
+    float angle; // Total swing angle swept, rad
+};
+
+#endif
@@ -38,6 +38,8 @@
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
+#if !FONTS_PACKED /* Otherwise the compressed glyphs of fonts_packed.c are linked */
+
 /** @addtogroup Utilities
   * @{
   */
@@ -1841,4 +1843,6 @@ sFONT Font16 = {
 /**
   * @}
   */  
+#endif /* !FONTS_PACKED */
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -46,6 +46,12 @@
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
 
+/* 1: link the compressed glyphs of fonts_packed.c (generated by tools/fontpack.py),
+   decoded into SDRAM on first use; 0: link the plain tables of font8.c to font24.c */
+#ifndef FONTS_PACKED
+#define FONTS_PACKED 1
+#endif
+
 /** @addtogroup Utilities
   * @{
   */
@@ -67,12 +73,23 @@
   */ 
 typedef struct _tFont
 {    
-  const uint8_t *table;
+  const uint8_t *table;     /* Plain glyphs; for packed fonts the SDRAM atlas, 0 until first use */
   uint16_t Width;
   uint16_t Height;
+  const uint8_t *pPacked;   /* Compressed glyphs (see tools/fontpack.py), 0 for plain fonts */
+  const uint16_t *pOffsets; /* Byte offset of each glyph in pPacked */
+  uint32_t Decoded[3];      /* One bit per glyph already decoded into the atlas */
   
 } sFONT;
 
+typedef struct _tFontA8
+{    
+  const uint8_t *table;   /* One alpha byte per pixel, Width*Height bytes per character from ' ' to '~' */
+  uint16_t Width;
+  uint16_t Height;
+  
+} sFONTA8;
+
 extern sFONT Font24;
 extern sFONT Font20;
 extern sFONT Font16;
@@ -0,0 +1,497 @@
+/* Compressed LCD fonts, generated by tools/fontpack.py from Fonts/font8.c to font24.c: do not edit.
+   Glyph format: see tools/fontpack.py. Linked instead of the plain tables when FONTS_PACKED is 1. */
+
+#include "fonts.h"
+
+#if FONTS_PACKED
+
+/* Font8: 5x8, 708 bytes packed (760 plain) */
+static const uint8_t Font8_Packed[] =
+{
+  0x00, 0x00, 0x01, 0x84, 0x1F, 0x40, 0x00, 0x82, 0x3B, 0x40, 0x01, 0xC0, 0x52, 0xAB, 0xEA, 0xFA,
+  0xA8, 0x01, 0xC2, 0x34, 0xF3, 0x39, 0x00, 0x01, 0x82, 0x44, 0x43, 0xC2, 0x20, 0x09, 0x42, 0x47,
+  0x4C, 0xAF, 0x00, 0xC4, 0x1E, 0x01, 0xC4, 0x26, 0xAA, 0x40, 0x01, 0xC2, 0x29, 0x55, 0x80, 0x01,
+  0x02, 0x35, 0xD5, 0x09, 0x40, 0x52, 0x13, 0xE4, 0x20, 0x20, 0xC4, 0x26, 0x80, 0x18, 0x42, 0x3E,
+  0x28, 0x44, 0x18, 0x01, 0xC0, 0x41, 0x22, 0x24, 0x48, 0x01, 0x82, 0x35, 0x6D, 0xA8, 0x01, 0x80,
+  0x56, 0x10, 0x84, 0x27, 0xC0, 0x01, 0x82, 0x35, 0x52, 0x9C, 0x01, 0x82, 0x35, 0x4A, 0x38, 0x01,
+  0x82, 0x42, 0x6A, 0xF2, 0x70, 0x01, 0x82, 0x3F, 0x31, 0xA8, 0x01, 0x82, 0x37, 0x35, 0xB8, 0x01,
+  0x82, 0x3F, 0x4A, 0x48, 0x01, 0x82, 0x35, 0x55, 0xA8, 0x01, 0x82, 0x37, 0x6B, 0x38, 0x11, 0x04,
+  0x19, 0x11, 0x04, 0x24, 0x60, 0x09, 0x40, 0x41, 0x2C, 0x21, 0x08, 0xC2, 0x3E, 0x38, 0x09, 0x42,
+  0x48, 0x43, 0x48, 0x01, 0x82, 0x35, 0x4A, 0x08, 0x01, 0xC2, 0x46, 0x99, 0xB9, 0x87, 0x01, 0x80,
+  0x56, 0x11, 0x4E, 0x8E, 0xC0, 0x01, 0x80, 0x5F, 0x25, 0xC9, 0x4F, 0x80, 0x01, 0x82, 0x3F, 0x64,
+  0x8C, 0x01, 0x80, 0x5F, 0x25, 0x29, 0x4F, 0x80, 0x01, 0x80, 0x5F, 0xA5, 0x88, 0x4F, 0xC0, 0x01,
+  0x80, 0x5F, 0xA5, 0x88, 0x47, 0x00, 0x01, 0x82, 0x4E, 0x88, 0xBA, 0x60, 0x01, 0x80, 0x5E, 0xA5,
+  0xE9, 0x4F, 0x40, 0x01, 0x82, 0x3E, 0x92, 0x5C, 0x01, 0x82, 0x47, 0x22, 0xAA, 0x40, 0x01, 0x80,
+  0x5D, 0xA9, 0x8E, 0x56, 0xC0, 0x01, 0x80, 0x5E, 0x21, 0x08, 0x4F, 0xC0, 0x01, 0x80, 0x5D, 0xEF,
+  0x75, 0x8E, 0xC0, 0x01, 0x80, 0x5D, 0xB5, 0xAB, 0x5F, 0x40, 0x01, 0x82, 0x46, 0x99, 0x99, 0x60,
+  0x01, 0x80, 0x5F, 0x25, 0x2E, 0x47, 0x00, 0x01, 0xC2, 0x46, 0x99, 0x99, 0x63, 0x01, 0x80, 0x5F,
+  0x25, 0x2E, 0x4F, 0x40, 0x01, 0x82, 0x3F, 0x51, 0xBC, 0x01, 0x80, 0x5F, 0xD4, 0x84, 0x23, 0x80,
+  0x01, 0x80, 0x5D, 0xA5, 0x29, 0x49, 0x80, 0x01, 0x80, 0x5D, 0xC5, 0x2A, 0x51, 0x80, 0x01, 0x80,
+  0x5D, 0xC6, 0xB5, 0xAA, 0x80, 0x01, 0x80, 0x5D, 0xA8, 0x84, 0x56, 0xC0, 0x01, 0x80, 0x5D, 0xC5,
+  0x44, 0x23, 0x80, 0x01, 0x82, 0x4F, 0x92, 0x49, 0xF0, 0x01, 0xC4, 0x2E, 0xAA, 0xC0, 0x01, 0xC0,
+  0x48, 0x44, 0x22, 0x21, 0x01, 0xC2, 0x2D, 0x55, 0xC0, 0x00, 0xC2, 0x34, 0xA8, 0x38, 0x40, 0x5F,
+  0x80, 0x00, 0x84, 0x29, 0x11, 0x02, 0x46, 0x2E, 0xF0, 0x01, 0x80, 0x5C, 0x21, 0xC9, 0x4F, 0x80,
+  0x11, 0x02, 0x3F, 0x27, 0x01, 0x82, 0x43, 0x17, 0x99, 0x70, 0x11, 0x02, 0x3F, 0xE3, 0x01, 0x82,
+  0x32, 0xBA, 0x5C, 0x11, 0x82, 0x47, 0x99, 0x71, 0x60, 0x01, 0x80, 0x5C, 0x21, 0xC9, 0x4F, 0x40,
+  0x01, 0x82, 0x34, 0x32, 0x5C, 0x02, 0x02, 0x34, 0x39, 0x24, 0xF0, 0x01, 0x80, 0x5C, 0x21, 0x6E,
+  0x56, 0xC0, 0x01, 0x82, 0x3C, 0x92, 0x5C, 0x11, 0x00, 0x5D, 0x56, 0xB5, 0x11, 0x00, 0x5F, 0x25,
+  0x39, 0x11, 0x02, 0x46, 0x99, 0x60, 0x11, 0x80, 0x5F, 0x25, 0x2E, 0x47, 0x00, 0x11, 0x82, 0x47,
+  0x99, 0x71, 0x30, 0x11, 0x02, 0x4F, 0x44, 0xE0, 0x11, 0x02, 0x36, 0x8E, 0x09, 0x40, 0x54, 0x79,
+  0x09, 0x30, 0x11, 0x00, 0x5D, 0xA5, 0x27, 0x11, 0x00, 0x5C, 0xA4, 0xC6, 0x11, 0x00, 0x5D, 0xD6,
+  0xAA, 0x11, 0x02, 0x49, 0x66, 0x90, 0x11, 0x80, 0x5D, 0xA9, 0x44, 0x23, 0x00, 0x11, 0x02, 0x4F,
+  0xA5, 0xF0, 0x01, 0xC2, 0x32, 0x96, 0x48, 0x80, 0x01, 0xC4, 0x1F, 0xE0, 0x01, 0xC2, 0x38, 0x93,
+  0x4A, 0x00, 0x18, 0x82, 0x45, 0xA0,
+};
+
+static const uint16_t Font8_Offsets[95] =
+{
+  0, 2, 6, 10, 17, 23, 29, 34, 37, 42, 47, 51,
+  57, 61, 64, 67, 73, 78, 85, 90, 95, 101, 106, 111,
+  116, 121, 126, 129, 133, 138, 142, 147, 152, 158, 165, 172,
+  177, 184, 191, 198, 204, 211, 216, 222, 229, 236, 243, 250,
+  256, 263, 269, 276, 281, 288, 295, 302, 309, 316, 323, 329,
+  334, 340, 345, 349, 353, 356, 361, 368, 372, 378, 382, 387,
+  393, 400, 405, 411, 418, 423, 428, 433, 438, 445, 451, 456,
+  460, 466, 471, 476, 481, 486, 493, 498, 504, 508, 514,
+};
+
+sFONT Font8 = {
+  0, /* Decoded on first use */
+  5, /* Width */
+  8, /* Height */
+  Font8_Packed,
+  Font8_Offsets,
+};
+
+/* Font12: 7x12, 910 bytes packed (1140 plain) */
+static const uint8_t Font12_Packed[] =
+{
+  0x00, 0x00, 0x0A, 0x06, 0x1F, 0x90, 0x08, 0xC2, 0x5D, 0xCA, 0x40, 0x0A, 0x42, 0x52, 0x95, 0x5F,
+  0x57, 0xD5, 0x4A, 0x00, 0x0A, 0x42, 0x42, 0x78, 0x87, 0x9E, 0x22, 0x0A, 0x02, 0x54, 0x51, 0x03,
+  0xE0, 0x8A, 0x20, 0x19, 0x82, 0x53, 0x21, 0x15, 0x93, 0x40, 0x09, 0x06, 0x1F, 0x0A, 0x86, 0x25,
+  0xAA, 0xA5, 0x0A, 0x84, 0x2A, 0x55, 0x5A, 0x09, 0x42, 0x52, 0x7C, 0x8A, 0x50, 0x11, 0xC0, 0x71,
+  0x02, 0x04, 0x7F, 0x10, 0x20, 0x40, 0x39, 0x04, 0x36, 0xB4, 0x28, 0x42, 0x5F, 0x80, 0x38, 0x84,
+  0x2F, 0x0A, 0x42, 0x50, 0x84, 0x42, 0x21, 0x10, 0x88, 0x00, 0x0A, 0x02, 0x57, 0x46, 0x31, 0x8C,
+  0x62, 0xE0, 0x0A, 0x02, 0x56, 0x10, 0x84, 0x21, 0x09, 0xF0, 0x0A, 0x02, 0x57, 0x44, 0x22, 0x22,
+  0x23, 0xF0, 0x0A, 0x02, 0x57, 0x44, 0x26, 0x08, 0x62, 0xE0, 0x0A, 0x02, 0x61, 0x8A, 0x29, 0x28,
+  0xBF, 0x08, 0x70, 0x0A, 0x02, 0x57, 0xA1, 0x0E, 0x08, 0x62, 0xE0, 0x0A, 0x02, 0x53, 0xA2, 0x1E,
+  0x8C, 0x62, 0xE0, 0x0A, 0x02, 0x5F, 0xC4, 0x22, 0x10, 0x88, 0x40, 0x0A, 0x02, 0x57, 0x46, 0x2E,
+  0x8C, 0x62, 0xE0, 0x0A, 0x02, 0x57, 0x46, 0x31, 0x78, 0x45, 0xC0, 0x19, 0x84, 0x2F, 0x0F, 0x19,
+  0xC4, 0x36, 0xC0, 0x7A, 0x00, 0x11, 0xC0, 0x60, 0xC4, 0x62, 0x06, 0x04, 0x0C, 0x20, 0xC2, 0x5F,
+  0x83, 0xE0, 0x11, 0xC0, 0x6C, 0x08, 0x18, 0x11, 0x88, 0xC0, 0x11, 0xC4, 0x46, 0x91, 0x24, 0x0C,
+  0x02, 0x82, 0x57, 0x46, 0x33, 0xAD, 0x67, 0x08, 0xB8, 0x0A, 0x00, 0x73, 0x02, 0x0A, 0x14, 0x28,
+  0xF9, 0x17, 0x70, 0x0A, 0x00, 0x6F, 0x91, 0x45, 0xE4, 0x51, 0x47, 0xE0, 0x0A, 0x02, 0x57, 0xC6,
+  0x10, 0x84, 0x22, 0xE0, 0x0A, 0x00, 0x6F, 0x12, 0x45, 0x14, 0x51, 0x4B, 0xC0, 0x0A, 0x00, 0x6F,
+  0xD1, 0x51, 0xC5, 0x10, 0x47, 0xF0, 0x0A, 0x02, 0x6F, 0xD1, 0x51, 0xC5, 0x10, 0x43, 0x80, 0x0A,
+  0x02, 0x67, 0xA2, 0x82, 0x09, 0xE2, 0x89, 0xC0, 0x0A, 0x00, 0x7E, 0xE8, 0x91, 0x3E, 0x44, 0x89,
+  0x17, 0x70, 0x0A, 0x02, 0x5F, 0x90, 0x84, 0x21, 0x09, 0xF0, 0x0A, 0x02, 0x57, 0x88, 0x42, 0x94,
+  0xA4, 0xC0, 0x0A, 0x00, 0x7E, 0xE8, 0x92, 0x28, 0x70, 0x91, 0x17, 0x30, 0x0A, 0x02, 0x5E, 0x21,
+  0x08, 0x42, 0x53, 0xF0, 0x0A, 0x00, 0x7E, 0xED, 0x9B, 0x2A, 0x54, 0x89, 0x17, 0x70, 0x0A, 0x00,
+  0x7E, 0xEC, 0x99, 0x2A, 0x54, 0xA9, 0x37, 0x60, 0x0A, 0x02, 0x57, 0x46, 0x31, 0x8C, 0x62, 0xE0,
+  0x0A, 0x02, 0x5F, 0x25, 0x29, 0x72, 0x11, 0xC0, 0x0A, 0x42, 0x57, 0x46, 0x31, 0x8C, 0x62, 0xE3,
+  0x80, 0x0A, 0x00, 0x7F, 0x88, 0x91, 0x22, 0x78, 0x91, 0x17, 0x10, 0x0A, 0x02, 0x56, 0xCE, 0x0E,
+  0x08, 0x73, 0x60, 0x0A, 0x00, 0x7F, 0xF2, 0x44, 0x08, 0x10, 0x20, 0x41, 0xC0, 0x0A, 0x00, 0x7E,
+  0xE8, 0x91, 0x22, 0x44, 0x89, 0x11, 0xC0, 0x0A, 0x00, 0x7E, 0xE8, 0x91, 0x14, 0x28, 0x50, 0x40,
+  0x80, 0x0A, 0x00, 0x7E, 0xE8, 0x91, 0x2A, 0x54, 0xA9, 0x51, 0x40, 0x0A, 0x00, 0x7C, 0x68, 0x8A,
+  0x08, 0x10, 0x51, 0x16, 0x30, 0x0A, 0x00, 0x7E, 0xE8, 0x8A, 0x14, 0x10, 0x20, 0x41, 0xC0, 0x0A,
+  0x02, 0x5F, 0xC4, 0x44, 0x22, 0x23, 0xF0, 0x0A, 0x84, 0x3F, 0x24, 0x92, 0x49, 0xC0, 0x0A, 0x42,
+  0x48, 0x44, 0x42, 0x21, 0x11, 0x0A, 0x84, 0x3E, 0x49, 0x24, 0x93, 0xC0, 0x09, 0x02, 0x52, 0x11,
+  0x51, 0x58, 0x40, 0x7F, 0xE0, 0x08, 0x86, 0x29, 0x19, 0x82, 0x67, 0x22, 0x7A, 0x28, 0x9F, 0x0A,
+  0x00, 0x6C, 0x10, 0x59, 0x94, 0x51, 0x47, 0xE0, 0x19, 0x82, 0x57, 0xC6, 0x10, 0x8B, 0x80, 0x0A,
+  0x02, 0x61, 0x82, 0x6A, 0x68, 0xA2, 0x89, 0xF0, 0x19, 0x82, 0x57, 0x47, 0xF0, 0x83, 0xC0, 0x0A,
+  0x02, 0x53, 0xA3, 0xE8, 0x42, 0x11, 0xF0, 0x1A, 0x02, 0x66, 0xE6, 0x8A, 0x28, 0x9E, 0x09, 0xC0,
+  0x0A, 0x00, 0x7C, 0x08, 0x16, 0x32, 0x44, 0x89, 0x17, 0x70, 0x0A, 0x02, 0x52, 0x03, 0x84, 0x21,
+  0x09, 0xF0, 0x0A, 0x82, 0x42, 0x0F, 0x11, 0x11, 0x11, 0xE0, 0x0A, 0x00, 0x6C, 0x10, 0x5D, 0x27,
+  0x14, 0x4B, 0x70, 0x0A, 0x02, 0x56, 0x10, 0x84, 0x21, 0x09, 0xF0, 0x19, 0x80, 0x7E, 0x8A, 0x95,
+  0x2A, 0x55, 0xFC, 0x19, 0x80, 0x7D, 0x8C, 0x91, 0x22, 0x45, 0xDC, 0x19, 0x82, 0x57, 0x46, 0x31,
+  0x8B, 0x80, 0x1A, 0x00, 0x6D, 0x99, 0x45, 0x14, 0x5E, 0x43, 0x80, 0x1A, 0x02, 0x66, 0xE6, 0x8A,
+  0x28, 0x9E, 0x08, 0x70, 0x19, 0x82, 0x5D, 0xB1, 0x08, 0x47, 0xC0, 0x19, 0x82, 0x57, 0xC5, 0xC1,
+  0x8F, 0x80, 0x11, 0xC2, 0x64, 0x3E, 0x41, 0x04, 0x11, 0x38, 0x19, 0x80, 0x7C, 0xC8, 0x91, 0x22,
+  0x4C, 0x6C, 0x19, 0x80, 0x7E, 0xE8, 0x91, 0x14, 0x28, 0x20, 0x19, 0x80, 0x7E, 0xE8, 0x95, 0x2A,
+  0x54, 0x50, 0x19, 0x80, 0x6C, 0xD2, 0x30, 0xC4, 0xB3, 0x1A, 0x00, 0x7E, 0xE8, 0x89, 0x14, 0x18,
+  0x20, 0x43, 0xC0, 0x19, 0x82, 0x5F, 0xC8, 0x88, 0x8F, 0xC0, 0x0A, 0x84, 0x32, 0x92, 0x51, 0x24,
+  0x40, 0x0A, 0x46, 0x1F, 0xF8, 0x0A, 0x84, 0x38, 0x92, 0x45, 0x25, 0x00, 0x28, 0x82, 0x54, 0xD8,
+};
+
+static const uint16_t Font12_Offsets[95] =
+{
+  0, 2, 6, 11, 20, 27, 35, 42, 45, 50, 55, 61,
+  70, 74, 78, 81, 90, 98, 106, 114, 122, 131, 139, 147,
+  155, 163, 171, 175, 181, 189, 194, 202, 208, 217, 227, 236,
+  244, 253, 262, 271, 280, 290, 298, 306, 316, 324, 334, 344,
+  352, 360, 369, 379, 387, 397, 407, 417, 427, 437, 447, 455,
+  462, 469, 476, 481, 485, 488, 495, 504, 511, 520, 527, 535,
+  544, 554, 562, 570, 579, 587, 595, 603, 610, 619, 628, 635,
+  642, 650, 658, 666, 674, 681, 691, 698, 705, 709, 716,
+};
+
+sFONT Font12 = {
+  0, /* Decoded on first use */
+  7, /* Width */
+  12, /* Height */
+  Font12_Packed,
+  Font12_Offsets,
+};
+
+/* Font16: 11x16, 1251 bytes packed (3040 plain) */
+static const uint8_t Font16_Packed[] =
+{
+  0x00, 0x00, 0x0A, 0x88, 0x2F, 0xFF, 0xF3, 0x11, 0x46, 0x7E, 0xFD, 0xD1, 0x22, 0x44, 0x0A, 0xC4,
+  0x83, 0x63, 0x63, 0x63, 0x6F, 0xF6, 0xCF, 0xF6, 0xC6, 0xC6, 0xC6, 0xC0, 0x03, 0x44, 0x71, 0x0F,
+  0xF1, 0xE3, 0xE0, 0xF0, 0xF0, 0x7C, 0x78, 0xFF, 0x08, 0x10, 0x0A, 0x84, 0x86, 0x09, 0x09, 0x06,
+  0x31, 0xE7, 0x8C, 0x60, 0x90, 0x90, 0x60, 0x12, 0x44, 0x73, 0xCC, 0x18, 0x30, 0x30, 0xEF, 0x76,
+  0x67, 0x60, 0x11, 0x4A, 0x3F, 0xD2, 0x40, 0x0B, 0x08, 0x43, 0x36, 0xEC, 0xCC, 0xCE, 0x63, 0x30,
+  0x0B, 0x06, 0x4C, 0xC6, 0x33, 0x33, 0x33, 0x6E, 0xC0, 0x09, 0xC4, 0x81, 0x81, 0x8F, 0xFF, 0xF3,
+  0xC7, 0xE6, 0x60, 0x19, 0xC4, 0x71, 0x02, 0x04, 0x7F, 0x10, 0x20, 0x40, 0x49, 0x48, 0x36, 0xB4,
+  0x80, 0x30, 0x44, 0x7F, 0xE0, 0x48, 0x88, 0x2F, 0x03, 0x44, 0x80, 0x30, 0x30, 0x60, 0x60, 0xC0,
+  0xC1, 0x83, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x00, 0x0A, 0x84, 0x73, 0x8D, 0xB1, 0xE3, 0xC7, 0x8F,
+  0x1E, 0x36, 0xC7, 0x00, 0x0A, 0x84, 0x81, 0x8F, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x8F,
+  0xF0, 0x0A, 0x84, 0x73, 0xCC, 0xF1, 0xE3, 0x0C, 0x30, 0xC3, 0x0C, 0x1F, 0xC0, 0x0A, 0x82, 0x87,
+  0xEC, 0x30, 0x30, 0x63, 0xE0, 0x70, 0x30, 0x3C, 0x37, 0xE0, 0x0A, 0x84, 0x71, 0xC3, 0x8F, 0x16,
+  0x6C, 0x9B, 0x37, 0xF0, 0xC7, 0xC0, 0x0A, 0x84, 0x77, 0xEC, 0x18, 0x30, 0x7C, 0x8C, 0x18, 0x38,
+  0x6F, 0x80, 0x0A, 0x84, 0x71, 0xEE, 0x18, 0x60, 0xDD, 0xCF, 0x1E, 0x36, 0x67, 0x80, 0x0A, 0x82,
+  0x7F, 0xF0, 0xC1, 0x86, 0x0C, 0x18, 0x30, 0xC1, 0x83, 0x00, 0x0A, 0x84, 0x77, 0xD8, 0xF1, 0xE3,
+  0x7D, 0x8F, 0x1E, 0x3C, 0x6F, 0x80, 0x0A, 0x84, 0x77, 0x99, 0xB1, 0xE3, 0xCE, 0xEC, 0x18, 0x61,
+  0xDE, 0x00, 0x21, 0xC8, 0x2F, 0x03, 0xC0, 0x22, 0x48, 0x43, 0x30, 0x00, 0x64, 0x88, 0x12, 0x42,
+  0x90, 0x18, 0x30, 0x20, 0x60, 0xC0, 0x18, 0x02, 0x00, 0xC0, 0x18, 0x28, 0xC2, 0x9F, 0xF8, 0x03,
+  0xFE, 0x12, 0x42, 0x9C, 0x01, 0x80, 0x20, 0x0C, 0x01, 0x83, 0x02, 0x06, 0x0C, 0x00, 0x12, 0x44,
+  0x77, 0xD8, 0xF1, 0x83, 0x1C, 0x60, 0xC0, 0x03, 0x00, 0x0A, 0xC4, 0x63, 0x91, 0x86, 0x19, 0xE9,
+  0xA6, 0x78, 0x11, 0x38, 0x12, 0x42, 0xA7, 0xE0, 0x78, 0x12, 0x0C, 0xC3, 0x30, 0xFC, 0x61, 0x98,
+  0x6F, 0x3C, 0x12, 0x42, 0x8F, 0xE6, 0x36, 0x36, 0x37, 0xE6, 0x36, 0x36, 0x3F, 0xE0, 0x12, 0x42,
+  0x93, 0xEB, 0x0F, 0x03, 0x80, 0xC0, 0x60, 0x30, 0x2C, 0x23, 0xE0, 0x12, 0x42, 0x9F, 0xE3, 0x19,
+  0x86, 0xC3, 0x61, 0xB0, 0xD8, 0x6C, 0x6F, 0xE0, 0x12, 0x42, 0x8F, 0xF6, 0x16, 0x16, 0x47, 0xC6,
+  0x46, 0x16, 0x1F, 0xF0, 0x12, 0x42, 0x9F, 0xFB, 0x05, 0x82, 0xC8, 0x7C, 0x32, 0x18, 0x0C, 0x0F,
+  0x80, 0x12, 0x42, 0x93, 0xD3, 0x1B, 0x05, 0x80, 0xC0, 0x67, 0xF0, 0xCC, 0x63, 0xE0, 0x12, 0x42,
+  0x9F, 0x7B, 0x19, 0x8C, 0xC6, 0x7F, 0x31, 0x98, 0xCC, 0x6F, 0x78, 0x12, 0x44, 0x8F, 0xF1, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x8F, 0xF0, 0x12, 0x42, 0x93, 0xF8, 0x30, 0x18, 0x0C, 0x06, 0x63,
+  0x31, 0x98, 0xC7, 0xC0, 0x12, 0x42, 0x9F, 0x7B, 0x19, 0x98, 0xD8, 0x78, 0x3E, 0x19, 0x8C, 0x6F,
+  0x38, 0x12, 0x42, 0x9F, 0xC1, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x4C, 0x26, 0x1F, 0xF8, 0x12, 0x40,
+  0xBE, 0x0E, 0xC1, 0x9C, 0x73, 0xDE, 0x6A, 0xCD, 0xD9, 0x93, 0x30, 0x6F, 0xBE, 0x12, 0x42, 0x9E,
+  0x7B, 0x19, 0xCC, 0xF6, 0x6B, 0x37, 0x99, 0xCC, 0x6F, 0x30, 0x12, 0x42, 0x93, 0xE3, 0x1B, 0x07,
+  0x83, 0xC1, 0xE0, 0xF0, 0x6C, 0x63, 0xE0, 0x12, 0x42, 0x8F, 0xE6, 0x36, 0x36, 0x36, 0x37, 0xE6,
+  0x06, 0x0F, 0xC0, 0x12, 0xC2, 0x93, 0xE3, 0x1B, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x6C, 0x63, 0xE0,
+  0xCC, 0xFC, 0x12, 0x42, 0xAF, 0xE1, 0x8C, 0x63, 0x18, 0xC7, 0xC1, 0x98, 0x63, 0x18, 0xCF, 0x9C,
+  0x12, 0x44, 0x77, 0xF8, 0xF1, 0xF0, 0x7C, 0x1F, 0x1E, 0x3F, 0xC0, 0x12, 0x42, 0x8F, 0xF9, 0x99,
+  0x99, 0x91, 0x81, 0x81, 0x81, 0x87, 0xE0, 0x12, 0x42, 0x9F, 0x7B, 0x19, 0x8C, 0xC6, 0x63, 0x31,
+  0x98, 0xCC, 0x63, 0xE0, 0x12, 0x42, 0x9F, 0x7B, 0x19, 0x8C, 0x6C, 0x36, 0x1B, 0x05, 0x03, 0x81,
+  0xC0, 0x12, 0x40, 0xBF, 0xBE, 0xC1, 0x99, 0x33, 0x76, 0x6E, 0xC5, 0x50, 0xEE, 0x1D, 0xC3, 0x18,
+  0x12, 0x42, 0x9F, 0x7B, 0x18, 0xD8, 0x38, 0x1C, 0x0E, 0x0D, 0x8C, 0x6F, 0x78, 0x12, 0x42, 0xAF,
+  0x3D, 0x86, 0x33, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x03, 0xF0, 0x12, 0x44, 0x7F, 0xF0, 0xE3,
+  0x0C, 0x10, 0x61, 0x8E, 0x1F, 0xE0, 0x0B, 0x0A, 0x4F, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xF0, 0x03,
+  0x44, 0x8C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x0B,
+  0x06, 0x4F, 0x33, 0x33, 0x33, 0x33, 0x33, 0xF0, 0x01, 0x84, 0x71, 0x05, 0x0A, 0x22, 0x83, 0x04,
+  0x78, 0x40, 0xBF, 0xFE, 0x00, 0xC8, 0x38, 0x88, 0x21, 0xC4, 0x87, 0xC0, 0x60, 0x67, 0xEC, 0x6C,
+  0xE7, 0x70, 0x0A, 0x82, 0x9E, 0x03, 0x01, 0x80, 0xDC, 0x73, 0x30, 0xD8, 0x6C, 0x37, 0x37, 0x70,
+  0x21, 0xC2, 0x83, 0xD6, 0x3C, 0x1C, 0x0C, 0x16, 0x33, 0xE0, 0x0A, 0x82, 0x90, 0x70, 0x18, 0x0C,
+  0x76, 0x67, 0x61, 0xB0, 0xD8, 0x66, 0x71, 0xDC, 0x21, 0xC2, 0x93, 0xE3, 0x1B, 0x07, 0xFF, 0xC0,
+  0x30, 0xCF, 0xC0, 0x0A, 0x84, 0x91, 0xF9, 0x80, 0xC1, 0xFC, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x07,
+  0xF0, 0x22, 0x82, 0x93, 0xBB, 0x3B, 0x0D, 0x86, 0xC3, 0x33, 0x8E, 0xC0, 0x60, 0x31, 0xF0, 0x0A,
+  0x82, 0x9E, 0x03, 0x01, 0x80, 0xDC, 0x73, 0x31, 0x98, 0xCC, 0x66, 0x37, 0xBC, 0x0A, 0x84, 0x81,
+  0x81, 0x80, 0x07, 0x81, 0x81, 0x81, 0x81, 0x81, 0x8F, 0xF0, 0x0B, 0x44, 0x61, 0x86, 0x03, 0xF0,
+  0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x3F, 0x80, 0x0A, 0x82, 0x9E, 0x03, 0x01, 0x80, 0xDE, 0x6C, 0x3C,
+  0x1E, 0x0D, 0x86, 0x67, 0x7C, 0x0A, 0x84, 0x87, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x8F, 0xF0, 0x21, 0xC2, 0xAF, 0xF1, 0xB6, 0x6D, 0x9B, 0x66, 0xD9, 0xB6, 0xED, 0xC0, 0x21, 0xC2,
+  0x9E, 0xE3, 0x99, 0x8C, 0xC6, 0x63, 0x31, 0xBD, 0xE0, 0x21, 0xC2, 0x93, 0xE3, 0x1B, 0x07, 0x83,
+  0xC1, 0xB1, 0x8F, 0x80, 0x22, 0x82, 0x9E, 0xE3, 0x99, 0x86, 0xC3, 0x61, 0xB9, 0x9B, 0x8C, 0x06,
+  0x07, 0xC0, 0x22, 0x82, 0x93, 0xBB, 0x3B, 0x0D, 0x86, 0xC3, 0x33, 0x8E, 0xC0, 0x60, 0x30, 0x7C,
+  0x21, 0xC2, 0x9F, 0x71, 0xCC, 0xC0, 0x60, 0x30, 0x18, 0x3F, 0x80, 0x21, 0xC4, 0x77, 0xF8, 0xFC,
+  0x3E, 0x0F, 0x8F, 0xF0, 0x0A, 0x82, 0x83, 0x03, 0x03, 0x0F, 0xE3, 0x03, 0x03, 0x03, 0x03, 0x11,
+  0xE0, 0x21, 0xC2, 0x9E, 0x73, 0x19, 0x8C, 0xC6, 0x63, 0x33, 0x8E, 0xE0, 0x21, 0xC2, 0x9F, 0x7B,
+  0x19, 0x8C, 0x6C, 0x36, 0x0E, 0x07, 0x00, 0x21, 0xC0, 0xBF, 0x1E, 0xC1, 0x99, 0x33, 0x76, 0x3B,
+  0x87, 0x70, 0xC6, 0x00, 0x21, 0xC2, 0x9F, 0x79, 0xB0, 0x70, 0x38, 0x1C, 0x1B, 0x3D, 0xE0, 0x22,
+  0x82, 0xAF, 0x3D, 0x86, 0x33, 0x0C, 0xC1, 0x60, 0x78, 0x0C, 0x03, 0x01, 0x81, 0xF0, 0x21, 0xC4,
+  0x7F, 0xF0, 0xC3, 0x1C, 0x61, 0x87, 0xF8, 0x0B, 0x06, 0x43, 0x66, 0x66, 0x6C, 0x66, 0x66, 0x30,
+  0x0B, 0x0A, 0x2F, 0xFF, 0xFF, 0xF0, 0x0B, 0x08, 0x4C, 0x66, 0x66, 0x63, 0x66, 0x66, 0xC0, 0x28,
+  0xC4, 0x76, 0x12, 0x43, 0x00,
+};
+
+static const uint16_t Font16_Offsets[95] =
+{
+  0, 2, 7, 14, 28, 42, 55, 66, 71, 80, 89, 99,
+  108, 113, 117, 120, 136, 148, 161, 173, 186, 198, 210, 222,
+  234, 246, 258, 263, 270, 283, 289, 302, 313, 324, 338, 350,
+  363, 376, 388, 401, 414, 427, 439, 452, 465, 478, 493, 506,
+  519, 531, 546, 560, 571, 583, 596, 609, 624, 637, 651, 662,
+  671, 687, 696, 704, 708, 712, 722, 736, 746, 760, 771, 785,
+  799, 813, 826, 839, 853, 866, 878, 889, 900, 914, 928, 939,
+  948, 961, 972, 983, 996, 1007, 1022, 1031, 1040, 1046, 1055,
+};
+
+sFONT Font16 = {
+  0, /* Decoded on first use */
+  11, /* Width */
+  16, /* Height */
+  Font16_Packed,
+  Font16_Offsets,
+};
+
+/* Font20: 14x20, 1667 bytes packed (3800 plain) */
+static const uint8_t Font20_Packed[] =
+{
+  0x00, 0x00, 0x0B, 0x4A, 0x3F, 0xFF, 0xFF, 0xA4, 0x07, 0xE0, 0x11, 0x86, 0x8E, 0x7E, 0x7E, 0x74,
+  0x24, 0x24, 0x20, 0x04, 0x04, 0xA3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x33, 0xFF, 0xFF, 0xCC, 0xC3,
+  0x33, 0xFF, 0xFF, 0xCC, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC0, 0x04, 0x06, 0x81, 0x81, 0x83, 0xF7,
+  0xFC, 0x3C, 0x0F, 0x87, 0xE0, 0x7C, 0x3C, 0x3F, 0xEF, 0xC1, 0x81, 0x81, 0x80, 0x0B, 0x44, 0x97,
+  0x04, 0x42, 0x21, 0x10, 0x71, 0x83, 0xCF, 0x9E, 0x0C, 0x70, 0x44, 0x22, 0x11, 0x07, 0x00, 0x1A,
+  0xC6, 0x91, 0xF3, 0xF9, 0x80, 0xC0, 0x30, 0x3C, 0xFF, 0xF9, 0xEC, 0x67, 0xFC, 0xF6, 0x11, 0x8C,
+  0x3F, 0xFA, 0x48, 0x0C, 0x0C, 0x43, 0x36, 0x66, 0xCC, 0xCC, 0xCC, 0x66, 0x63, 0x30, 0x0C, 0x08,
+  0x4C, 0xC6, 0x66, 0x33, 0x33, 0x33, 0x66, 0x6C, 0xC0, 0x0A, 0x46, 0x81, 0x81, 0x81, 0x8D, 0xBF,
+  0xF3, 0xC3, 0xC7, 0xE6, 0x60, 0x1A, 0x84, 0xA0, 0xC0, 0x30, 0x0C, 0x03, 0x0F, 0xFF, 0xFF, 0x0C,
+  0x03, 0x00, 0xC0, 0x30, 0x59, 0x8A, 0x47, 0x66, 0xCC, 0x80, 0x38, 0x84, 0x9F, 0xFF, 0xFC, 0x58,
+  0xCC, 0x3F, 0xF8, 0x04, 0x06, 0x80, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0xC1, 0x81, 0x83, 0x03,
+  0x06, 0x06, 0x06, 0x0C, 0x0C, 0x00, 0x0B, 0x44, 0x93, 0xE3, 0xF9, 0x8D, 0x83, 0xC1, 0xE0, 0xF0,
+  0x78, 0x3C, 0x1E, 0x0D, 0x8C, 0xFE, 0x3E, 0x00, 0x0B, 0x46, 0x81, 0x8F, 0x8F, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x8F, 0xFF, 0xF0, 0x0B, 0x44, 0x93, 0xE3, 0xFB, 0x8F, 0x83, 0x01,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x80, 0x0B, 0x42, 0xA1, 0xF1, 0xFE, 0x61,
+  0xC0, 0x30, 0x1C, 0x3E, 0x0F, 0x80, 0x70, 0x0C, 0x03, 0xC1, 0xFF, 0xE7, 0xF0, 0x0B, 0x44, 0x90,
+  0x70, 0x78, 0x3C, 0x36, 0x33, 0x19, 0x98, 0xD8, 0x6F, 0xFF, 0xFC, 0x0C, 0x1F, 0x0F, 0x80, 0x0B,
+  0x44, 0x97, 0xF3, 0xF9, 0x80, 0xC0, 0x7E, 0x3F, 0x98, 0xE0, 0x30, 0x18, 0x0F, 0x0F, 0xFE, 0x7E,
+  0x00, 0x0B, 0x44, 0x90, 0xF9, 0xFD, 0xE0, 0xC0, 0xE0, 0x6F, 0x3F, 0xDC, 0x7C, 0x1E, 0x0D, 0x8E,
+  0xFE, 0x1E, 0x00, 0x0B, 0x44, 0x9F, 0xFF, 0xFF, 0x06, 0x03, 0x03, 0x01, 0x80, 0xC0, 0xC0, 0x60,
+  0x30, 0x30, 0x18, 0x0C, 0x00, 0x0B, 0x44, 0x93, 0xE3, 0xFB, 0x8F, 0x83, 0xE3, 0xBF, 0x9F, 0xDC,
+  0x7C, 0x1E, 0x0F, 0x8E, 0xFE, 0x3E, 0x00, 0x0B, 0x44, 0x93, 0xC3, 0xFB, 0x8D, 0x83, 0xC1, 0xF1,
+  0xDF, 0xE7, 0xB0, 0x38, 0x18, 0x3D, 0xFC, 0xF8, 0x00, 0x2A, 0x4C, 0x3F, 0xF8, 0x03, 0xFE, 0x2A,
+  0xCA, 0x53, 0x9C, 0xE0, 0x00, 0x1C, 0xCC, 0x62, 0x00, 0x1A, 0xC2, 0xB0, 0x06, 0x03, 0xC1, 0xE0,
+  0x70, 0x38, 0x1E, 0x00, 0xE0, 0x07, 0x00, 0x78, 0x03, 0xC0, 0x18, 0x29, 0x82, 0xBF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x1A, 0xC4, 0xBC, 0x01, 0xE0, 0x0F, 0x00, 0x70, 0x03, 0x80,
+  0x3C, 0x0E, 0x07, 0x03, 0xC1, 0xE0, 0x30, 0x00, 0x13, 0x06, 0x87, 0xCF, 0xEC, 0x3C, 0x30, 0x30,
+  0xE1, 0xC1, 0x80, 0x00, 0x03, 0x83, 0x80, 0x0B, 0x86, 0x71, 0xCC, 0x90, 0xC1, 0x83, 0x1E, 0x4C,
+  0x99, 0x31, 0xE0, 0x20, 0x42, 0x78, 0x13, 0x02, 0xC3, 0xF0, 0x3F, 0x00, 0x70, 0x0D, 0x80, 0xD8,
+  0x19, 0x81, 0x8C, 0x3F, 0xC3, 0xFC, 0x60, 0x6F, 0x0F, 0xF0, 0xF0, 0x13, 0x04, 0xAF, 0xE3, 0xFC,
+  0x61, 0x98, 0x66, 0x39, 0xFC, 0x7F, 0x98, 0x76, 0x0D, 0x83, 0xFF, 0xFF, 0xE0, 0x13, 0x04, 0xA1,
+  0xEC, 0xFF, 0x71, 0xF8, 0x3C, 0x03, 0x00, 0xC0, 0x30, 0x0E, 0x0D, 0xC7, 0x3F, 0x87, 0xC0, 0x13,
+  0x02, 0xBF, 0xF1, 0xFF, 0x18, 0x73, 0x07, 0x60, 0x6C, 0x0D, 0x81, 0xB0, 0x36, 0x0E, 0xC3, 0xBF,
+  0xE7, 0xF8, 0x13, 0x04, 0xAF, 0xFF, 0xFF, 0x60, 0xD8, 0x36, 0x61, 0xF8, 0x7E, 0x19, 0x86, 0x0D,
+  0x83, 0xFF, 0xFF, 0xF0, 0x13, 0x04, 0xAF, 0xFF, 0xFF, 0x60, 0xD8, 0x36, 0x61, 0xF8, 0x7E, 0x19,
+  0x86, 0x01, 0x80, 0xFC, 0x3F, 0x00, 0x13, 0x04, 0xB1, 0xEC, 0xFF, 0x98, 0x76, 0x06, 0xC0, 0x18,
+  0x03, 0x1F, 0xE3, 0xFC, 0x0C, 0xC1, 0x9F, 0xF0, 0xF8, 0x13, 0x04, 0xAF, 0x3F, 0xCF, 0x61, 0x98,
+  0x66, 0x19, 0xFE, 0x7F, 0x98, 0x66, 0x19, 0x86, 0xF3, 0xFC, 0xF0, 0x13, 0x06, 0x8F, 0xFF, 0xF1,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x8F, 0xFF, 0xF0, 0x13, 0x04, 0xB0, 0xFE, 0x1F, 0xC0,
+  0x60, 0x0C, 0x01, 0x80, 0x33, 0x06, 0x60, 0xCC, 0x19, 0x87, 0x3F, 0xC1, 0xF0, 0x13, 0x04, 0xBF,
+  0xBF, 0xF7, 0xD8, 0xE3, 0x30, 0x6C, 0x0F, 0x81, 0xD8, 0x31, 0x86, 0x30, 0xC3, 0x3E, 0x7F, 0xC7,
+  0x13, 0x04, 0xAF, 0xC3, 0xF0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x33, 0x0C, 0xC3, 0xFF,
+  0xFF, 0xF0, 0x13, 0x02, 0xCF, 0x0F, 0xF0, 0xF7, 0x0E, 0x79, 0xE6, 0x96, 0x6F, 0x66, 0xF6, 0x66,
+  0x66, 0x66, 0x60, 0x6F, 0x9F, 0xF9, 0xF0, 0x13, 0x04, 0xAE, 0x7F, 0xDF, 0x71, 0x9E, 0x67, 0x99,
+  0xB6, 0x6D, 0x99, 0xE6, 0x79, 0x8E, 0xFB, 0xBE, 0x60, 0x13, 0x04, 0xA1, 0xE0, 0xFC, 0x73, 0xB8,
+  0x7C, 0x0F, 0x03, 0xC0, 0xF0, 0x3E, 0x1D, 0xCE, 0x3F, 0x07, 0x80, 0x13, 0x04, 0xAF, 0xF3, 0xFE,
+  0x61, 0xD8, 0x36, 0x0D, 0x87, 0x7F, 0x9F, 0xC6, 0x01, 0x80, 0xFC, 0x3F, 0x00, 0x13, 0xC4, 0xA1,
+  0xE0, 0xFC, 0x73, 0xB8, 0x7C, 0x0F, 0x03, 0xC0, 0xF0, 0x3E, 0x1D, 0xCE, 0x3F, 0x07, 0x81, 0xEC,
+  0xFF, 0x33, 0x80, 0x13, 0x04, 0xBF, 0xF1, 0xFF, 0x18, 0x73, 0x06, 0x61, 0xCF, 0xF1, 0xFC, 0x31,
+  0xC6, 0x18, 0xC3, 0xBE, 0x3F, 0xC3, 0x13, 0x04, 0xA3, 0xED, 0xFF, 0xE1, 0xF0, 0x3E, 0x01, 0xF8,
+  0x1F, 0x80, 0x7C, 0x0F, 0x87, 0xFF, 0xB7, 0xC0, 0x13, 0x04, 0xAF, 0xFF, 0xFF, 0xCC, 0xF3, 0x3C,
+  0xCC, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x3F, 0x0F, 0xC0, 0x13, 0x04, 0xAF, 0x3F, 0xCF, 0x61,
+  0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0xCE, 0x3F, 0x07, 0x80, 0x13, 0x02, 0xBF, 0x1F,
+  0xE3, 0xD8, 0x33, 0x06, 0x31, 0x86, 0x30, 0x6C, 0x0D, 0x81, 0xB0, 0x1C, 0x03, 0x80, 0x70, 0x13,
+  0x02, 0xDF, 0x8F, 0xFC, 0x7D, 0x80, 0xCC, 0xE6, 0x67, 0x33, 0x39, 0x9B, 0x6C, 0x5B, 0x43, 0x8E,
+  0x1C, 0x70, 0xE3, 0x86, 0x0C, 0x13, 0x02, 0xBF, 0x1F, 0xE3, 0xD8, 0x31, 0x8C, 0x1B, 0x01, 0xC0,
+  0x38, 0x0D, 0x83, 0x18, 0xC1, 0xBC, 0x7F, 0x8F, 0x13, 0x04, 0xAF, 0x3F, 0xCF, 0x61, 0x8C, 0xC1,
+  0xE0, 0x78, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x3F, 0x0F, 0xC0, 0x13, 0x06, 0x8F, 0xFF, 0xFC, 0x3C,
+  0x60, 0xC1, 0x81, 0x83, 0x06, 0x3C, 0x3F, 0xFF, 0xF0, 0x0C, 0x0C, 0x4F, 0xFC, 0xCC, 0xCC, 0xCC,
+  0xCC, 0xCC, 0xCF, 0xF0, 0x04, 0x06, 0x8C, 0x0C, 0x06, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80,
+  0xC0, 0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x0C, 0x08, 0x4F, 0xF3, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x3F, 0xF0, 0x09, 0x84, 0x90, 0x80, 0xE0, 0xD8, 0xC6, 0xC1, 0xC0, 0x40, 0x90, 0x80, 0xEF, 0xFF,
+  0xFF, 0xFF, 0x08, 0xCA, 0x48, 0x61, 0x2A, 0x44, 0xA3, 0xF1, 0xFE, 0x01, 0x8F, 0xE7, 0xFB, 0x86,
+  0xC3, 0xBF, 0xF7, 0xDC, 0x0B, 0x42, 0xBE, 0x01, 0xC0, 0x18, 0x03, 0x00, 0x6F, 0x0F, 0xF9, 0xC3,
+  0x30, 0x36, 0x06, 0xC0, 0xDC, 0x37, 0xFE, 0xEF, 0x00, 0x2A, 0x44, 0xA1, 0xED, 0xFF, 0x60, 0xF0,
+  0x3C, 0x03, 0x00, 0xE0, 0xDF, 0xF3, 0xF0, 0x0B, 0x44, 0xB0, 0x1C, 0x03, 0x80, 0x30, 0x06, 0x1E,
+  0xCF, 0xF9, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0xB8, 0x73, 0xFF, 0x1E, 0xE0, 0x2A, 0x44, 0xA1, 0xE1,
+  0xFE, 0x61, 0xBF, 0xFF, 0xFF, 0x00, 0x60, 0xDF, 0xF1, 0xF0, 0x0B, 0x46, 0x91, 0xF9, 0xFC, 0xC0,
+  0x60, 0xFF, 0x7F, 0x8C, 0x06, 0x03, 0x01, 0x80, 0xC1, 0xFE, 0xFF, 0x00, 0x2B, 0x44, 0xB1, 0xEE,
+  0xFF, 0xD8, 0x76, 0x06, 0xC0, 0xD8, 0x19, 0x87, 0x3F, 0xE1, 0xEC, 0x01, 0x80, 0x71, 0xFC, 0x3F,
+  0x00, 0x0B, 0x44, 0xAE, 0x03, 0x80, 0x60, 0x18, 0x06, 0xF1, 0xFE, 0x71, 0x98, 0x66, 0x19, 0x86,
+  0x61, 0xBC, 0xFF, 0x3C, 0x0B, 0x46, 0x81, 0x81, 0x80, 0x00, 0x0F, 0x8F, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x8F, 0xFF, 0xF0, 0x0C, 0x44, 0x80, 0xC0, 0xC0, 0x00, 0x07, 0xF7, 0xF0, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x7F, 0xEF, 0xC0, 0x0B, 0x44, 0xAE, 0x03, 0x80, 0x60, 0x18, 0x06,
+  0xF9, 0xBE, 0x6C, 0x1E, 0x07, 0x81, 0xB0, 0x66, 0x39, 0xFE, 0x7C, 0x0B, 0x46, 0x8F, 0x8F, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x8F, 0xFF, 0xF0, 0x2A, 0x42, 0xCF, 0xDC, 0xFF,
+  0xE6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xF7, 0x7F, 0x77, 0x2A, 0x44, 0xAE, 0xF3, 0xFE,
+  0x71, 0x98, 0x66, 0x19, 0x86, 0x61, 0xBC, 0xFF, 0x3C, 0x2A, 0x44, 0xA1, 0xE1, 0xFE, 0x61, 0xB0,
+  0x3C, 0x0F, 0x03, 0x61, 0x9F, 0xE1, 0xE0, 0x2B, 0x42, 0xBE, 0xF1, 0xFF, 0x9C, 0x33, 0x03, 0x60,
+  0x6C, 0x0D, 0xC3, 0x3F, 0xE6, 0xF0, 0xC0, 0x18, 0x07, 0xC0, 0xF8, 0x00, 0x2B, 0x44, 0xB1, 0xEE,
+  0xFF, 0xD8, 0x76, 0x06, 0xC0, 0xD8, 0x19, 0x87, 0x3F, 0xE1, 0xEC, 0x01, 0x80, 0x30, 0x1F, 0x03,
+  0xE0, 0x2A, 0x44, 0xAF, 0x3B, 0xDF, 0x3C, 0xCE, 0x03, 0x00, 0xC0, 0x30, 0x3F, 0xCF, 0xF0, 0x2A,
+  0x46, 0x83, 0xFF, 0xFC, 0x3F, 0x07, 0xE0, 0xFC, 0x3F, 0xFF, 0xC0, 0x13, 0x04, 0xA3, 0x00, 0xC0,
+  0x30, 0x3F, 0xEF, 0xF8, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC3, 0x3F, 0xC7, 0xC0, 0x2A, 0x44, 0xAE,
+  0x3B, 0x8E, 0x61, 0x98, 0x66, 0x19, 0x86, 0x63, 0x9F, 0xF3, 0xDC, 0x2A, 0x42, 0xBF, 0x1F, 0xE3,
+  0xD8, 0x31, 0x8C, 0x31, 0x83, 0x60, 0x6C, 0x07, 0x00, 0xE0, 0x2A, 0x42, 0xBF, 0x1F, 0xE3, 0xD9,
+  0x33, 0x26, 0x6F, 0xC7, 0x70, 0xEE, 0x18, 0xC3, 0x18, 0x2A, 0x44, 0xAF, 0x3F, 0xCF, 0x33, 0x07,
+  0x80, 0xC0, 0x78, 0x33, 0x3C, 0xFF, 0x3C, 0x2B, 0x42, 0xBF, 0x1F, 0xE3, 0xD8, 0x31, 0x8C, 0x31,
+  0x83, 0x60, 0x7C, 0x07, 0x00, 0xC0, 0x18, 0x06, 0x07, 0xF0, 0xFE, 0x00, 0x2A, 0x46, 0x8F, 0xFF,
+  0xFC, 0x60, 0xC1, 0x83, 0x06, 0x3F, 0xFF, 0xF0, 0x0C, 0x08, 0x61, 0xCF, 0x30, 0xC3, 0x0C, 0x31,
+  0xCE, 0x1C, 0x30, 0xC3, 0x0C, 0x3C, 0x70, 0x0C, 0x0C, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0C, 0x06,
+  0x6E, 0x3C, 0x30, 0xC3, 0x0C, 0x30, 0xE1, 0xCE, 0x30, 0xC3, 0x0C, 0xF3, 0x80, 0x31, 0x04, 0xA3,
+  0x83, 0xF3, 0xCF, 0xC1, 0xE0,
+};
+
+static const uint16_t Font20_Offsets[95] =
+{
+  0, 2, 10, 19, 42, 61, 79, 94, 99, 110, 121, 133,
+  148, 154, 159, 163, 182, 200, 216, 234, 253, 271, 289, 307,
+  325, 343, 361, 367, 377, 395, 406, 424, 439, 454, 475, 493,
+  511, 530, 548, 566, 585, 603, 618, 637, 656, 674, 695, 713,
+  731, 749, 771, 790, 808, 826, 844, 863, 885, 904, 922, 937,
+  948, 967, 978, 988, 994, 998, 1012, 1033, 1047, 1068, 1082, 1100,
+  1121, 1140, 1156, 1176, 1195, 1211, 1227, 1241, 1255, 1276, 1297, 1311,
+  1323, 1341, 1355, 1370, 1385, 1399, 1420, 1432, 1447, 1454, 1469,
+};
+
+sFONT Font20 = {
+  0, /* Decoded on first use */
+  14, /* Width */
+  20, /* Height */
+  Font20_Packed,
+  Font20_Offsets,
+};
+
+/* Font24: 17x24, 2199 bytes packed (6840 plain) */
+static const uint8_t Font24_Packed[] =
+{
+  0x00, 0x00, 0x13, 0xCC, 0x3F, 0xFF, 0xFF, 0xFE, 0x90, 0x1F, 0x80, 0x19, 0xC8, 0x8E, 0x7E, 0x7E,
+  0x74, 0x24, 0x24, 0x24, 0x20, 0x14, 0x04, 0xB1, 0x98, 0x33, 0x06, 0x60, 0xCC, 0x19, 0x9F, 0xFF,
+  0xFF, 0x8C, 0xC3, 0x31, 0xFF, 0xFF, 0xF9, 0x98, 0x33, 0x06, 0x60, 0xCC, 0x19, 0x80, 0x0C, 0xC6,
+  0x90, 0xC0, 0x60, 0xF6, 0xFF, 0xC3, 0xE1, 0xF8, 0x0F, 0x83, 0xF0, 0x3F, 0x07, 0xC3, 0xE3, 0xFF,
+  0xB7, 0x81, 0x80, 0xC0, 0x60, 0x30, 0x13, 0xC6, 0xA3, 0xC1, 0xF8, 0xE7, 0x30, 0xCC, 0x33, 0x9C,
+  0x7F, 0xCF, 0xCF, 0xF8, 0xE7, 0x30, 0xCC, 0x33, 0x9C, 0x7E, 0x0F, 0x00, 0x23, 0x46, 0xB1, 0xF8,
+  0x7F, 0x18, 0xC3, 0x00, 0x60, 0x06, 0x00, 0xE0, 0x3E, 0x7E, 0xFF, 0x8F, 0x30, 0xE3, 0xFF, 0x3E,
+  0xE0, 0x19, 0xCC, 0x3F, 0xFA, 0x49, 0x00, 0x14, 0x8E, 0x60, 0xC7, 0x39, 0xE7, 0x1C, 0xE3, 0x8E,
+  0x38, 0xE3, 0x87, 0x1C, 0x38, 0xE1, 0xC3, 0x14, 0x86, 0x6C, 0x38, 0x71, 0xC3, 0x8E, 0x1C, 0x71,
+  0xC7, 0x1C, 0x73, 0x8E, 0x79, 0xCE, 0x30, 0x12, 0x86, 0xA0, 0xC0, 0x30, 0x0C, 0x3B, 0x7F, 0xFC,
+  0xFC, 0x1E, 0x07, 0x83, 0x30, 0xCC, 0x23, 0x04, 0xC0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x71, 0xCC, 0x53, 0x99, 0xCC,
+  0x66, 0x30, 0x48, 0x86, 0xAF, 0xFF, 0xFF, 0x70, 0xCC, 0x4F, 0xFF, 0x05, 0x06, 0xA0, 0x0C, 0x03,
+  0x01, 0xC0, 0x60, 0x38, 0x0C, 0x03, 0x01, 0x80, 0x60, 0x30, 0x0C, 0x06, 0x01, 0x80, 0xC0, 0x30,
+  0x1C, 0x06, 0x03, 0x80, 0xC0, 0x30, 0x00, 0x13, 0xC6, 0xA1, 0xE0, 0xFC, 0x61, 0x98, 0x6C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x66, 0x18, 0xFC, 0x1E, 0x00, 0x13, 0xC6, 0xA0,
+  0x40, 0xF0, 0xFC, 0x3B, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC3,
+  0xFF, 0xFF, 0xC0, 0x13, 0xC4, 0xB1, 0xF0, 0xFF, 0xB8, 0x36, 0x03, 0xC0, 0x60, 0x0C, 0x03, 0x00,
+  0xC0, 0x70, 0x1C, 0x06, 0x01, 0x80, 0x60, 0x1F, 0xFF, 0xFF, 0x80, 0x13, 0xC6, 0xA1, 0xE1, 0xFC,
+  0x63, 0x80, 0x60, 0x18, 0x0C, 0x1E, 0x07, 0xC0, 0x38, 0x03, 0x00, 0xC0, 0x3C, 0x1F, 0xFE, 0x7E,
+  0x00, 0x13, 0xC4, 0xB0, 0x38, 0x0F, 0x01, 0xE0, 0x6C, 0x19, 0x83, 0x30, 0xC6, 0x18, 0xC6, 0x19,
+  0x83, 0x3F, 0xFF, 0xFF, 0x01, 0x81, 0xFC, 0x3F, 0x80, 0x13, 0xC4, 0xB7, 0xFC, 0xFF, 0x98, 0x03,
+  0x00, 0x60, 0x0D, 0xE1, 0xFF, 0x38, 0x60, 0x06, 0x00, 0xC0, 0x18, 0x03, 0xC0, 0xDF, 0xF8, 0xFC,
+  0x00, 0x13, 0xC6, 0xA0, 0x7C, 0x7F, 0x38, 0x1C, 0x06, 0x03, 0x00, 0xDE, 0x3F, 0xEE, 0x1B, 0x03,
+  0xC0, 0xF0, 0x36, 0x1D, 0xFE, 0x1F, 0x00, 0x13, 0xC6, 0xAF, 0xFF, 0xFF, 0xC0, 0xF0, 0x70, 0x18,
+  0x06, 0x03, 0x80, 0xC0, 0x30, 0x1C, 0x06, 0x01, 0x80, 0xE0, 0x30, 0x0C, 0x00, 0x13, 0xC6, 0xA3,
+  0xF1, 0xFE, 0xE1, 0xF0, 0x3C, 0x0D, 0x86, 0x3F, 0x0F, 0xC6, 0x1B, 0x03, 0xC0, 0xF0, 0x3E, 0x1D,
+  0xFE, 0x3F, 0x00, 0x13, 0xC6, 0xA3, 0xE1, 0xFE, 0xE1, 0xB0, 0x3C, 0x0F, 0x03, 0x61, 0xDF, 0xF1,
+  0xEC, 0x03, 0x01, 0x80, 0xE0, 0x73, 0xF8, 0xF8, 0x00, 0x32, 0xCC, 0x4F, 0xFF, 0x00, 0x00, 0x0F,
+  0xFF, 0x33, 0x4C, 0x63, 0xCF, 0x3C, 0x00, 0x00, 0x00, 0xE7, 0x18, 0x63, 0x08, 0x00, 0x23, 0x40,
+  0xE0, 0x01, 0xC0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+  0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xC0, 0x39, 0x82, 0xDF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x23, 0x42, 0xEE, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C,
+  0x00, 0x3C, 0x00, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x0E, 0x00, 0x00, 0x1B,
+  0x86, 0x93, 0xE3, 0xFB, 0x0F, 0x83, 0xC1, 0x81, 0xC1, 0xC3, 0xC1, 0xC0, 0xC0, 0x00, 0x00, 0x38,
+  0x1C, 0x00, 0x14, 0x46, 0xA1, 0xF0, 0xFE, 0x71, 0xD8, 0x3C, 0x3F, 0x1F, 0xCE, 0xF3, 0x3C, 0xCF,
+  0x33, 0xC7, 0xF0, 0xFC, 0x01, 0x80, 0x70, 0xCF, 0xF1, 0xF0, 0x1B, 0x81, 0x01, 0xF8, 0x01, 0xFC,
+  0x00, 0x1C, 0x00, 0x36, 0x00, 0x36, 0x00, 0x63, 0x00, 0x63, 0x00, 0xC3, 0x00, 0xFF, 0x81, 0xFF,
+  0x81, 0x80, 0xC3, 0x00, 0xCF, 0xC7, 0xFF, 0xC7, 0xF0, 0x1B, 0x82, 0xDF, 0xFC, 0x7F, 0xF0, 0xC1,
+  0xC6, 0x06, 0x30, 0x31, 0x83, 0x8F, 0xF8, 0x7F, 0xE3, 0x03, 0x98, 0x0C, 0xC0, 0x66, 0x03, 0xFF,
+  0xF7, 0xFF, 0x00, 0x1B, 0x84, 0xC0, 0xFB, 0x3F, 0xF7, 0x07, 0x60, 0x3C, 0x03, 0xC0, 0x0C, 0x00,
+  0xC0, 0x0C, 0x00, 0xC0, 0x06, 0x03, 0x70, 0x73, 0xFE, 0x0F, 0xC0, 0x1B, 0x82, 0xDF, 0xF8, 0x7F,
+  0xF0, 0xC1, 0xC6, 0x06, 0x30, 0x19, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0xC6,
+  0x0E, 0xFF, 0xE7, 0xFE, 0x00, 0x1B, 0x82, 0xCF, 0xFF, 0xFF, 0xF3, 0x03, 0x30, 0x33, 0x33, 0x33,
+  0x03, 0xF0, 0x3F, 0x03, 0x30, 0x33, 0x33, 0x03, 0x30, 0x3F, 0xFF, 0xFF, 0xF0, 0x1B, 0x84, 0xCF,
+  0xFF, 0xFF, 0xF3, 0x03, 0x30, 0x33, 0x33, 0x33, 0x03, 0xF0, 0x3F, 0x03, 0x30, 0x33, 0x03, 0x00,
+  0x30, 0x0F, 0xF0, 0xFF, 0x00, 0x1B, 0x84, 0xD0, 0xFB, 0x1F, 0xF9, 0xC1, 0xCC, 0x06, 0xC0, 0x36,
+  0x00, 0x30, 0x01, 0x87, 0xFC, 0x3F, 0xE0, 0x1B, 0x80, 0xCE, 0x0E, 0x3F, 0xF0, 0x7E, 0x00, 0x1B,
+  0x82, 0xEF, 0xCF, 0xFF, 0x3F, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x3F, 0xF0, 0xFF, 0xC3,
+  0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xCF, 0xCF, 0xFF, 0x3F, 0x1B, 0x86, 0xAF, 0xFF, 0xFF, 0x0C,
+  0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x0F, 0xFF, 0xFF, 0x1B, 0x84,
+  0xD1, 0xFF, 0x8F, 0xFC, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x31, 0x81, 0x8C, 0x0C, 0x60,
+  0x63, 0x03, 0x18, 0x30, 0xFF, 0x81, 0xF0, 0x00, 0x1B, 0x82, 0xFF, 0xE7, 0xDF, 0xCF, 0x8C, 0x18,
+  0x18, 0x60, 0x31, 0x80, 0x66, 0x00, 0xDC, 0x01, 0xFC, 0x03, 0x9C, 0x06, 0x1C, 0x0C, 0x18, 0x18,
+  0x38, 0xFE, 0x3F, 0xFC, 0x7C, 0x1B, 0x82, 0xDF, 0xF0, 0x7F, 0x80, 0x60, 0x03, 0x00, 0x18, 0x00,
+  0xC0, 0x06, 0x00, 0x30, 0x01, 0x81, 0x8C, 0x0C, 0x60, 0x63, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1B,
+  0x81, 0x0F, 0x00, 0xFF, 0x81, 0xF3, 0x81, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x66, 0xC3, 0x66, 0xC3,
+  0x3C, 0xC3, 0x3C, 0xC3, 0x18, 0xC3, 0x00, 0xC3, 0x00, 0xCF, 0xE7, 0xFF, 0xE7, 0xF0, 0x1B, 0x82,
+  0xEF, 0x1F, 0xFC, 0x7F, 0x38, 0x30, 0xF0, 0xC3, 0xE3, 0x0D, 0x8C, 0x37, 0x30, 0xCE, 0xC3, 0x1B,
+  0x0C, 0x7C, 0x30, 0xF0, 0xC1, 0xCF, 0xE3, 0x3F, 0x8C, 0x1B, 0x84, 0xC0, 0xF0, 0x3F, 0xC7, 0x0E,
+  0x60, 0x6E, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xE0, 0x76, 0x06, 0x70, 0xE3, 0xFC, 0x0F,
+  0x00, 0x1B, 0x84, 0xCF, 0xFC, 0xFF, 0xE3, 0x07, 0x30, 0x33, 0x03, 0x30, 0x33, 0x06, 0x3F, 0xE3,
+  0xF8, 0x30, 0x03, 0x00, 0x30, 0x0F, 0xF0, 0xFF, 0x00, 0x1C, 0x44, 0xC0, 0xF0, 0x3F, 0xC7, 0x0E,
+  0x60, 0x6E, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xE0, 0x76, 0x06, 0x70, 0xE3, 0xFC, 0x1F,
+  0x01, 0xF3, 0x3F, 0xF3, 0x0E, 0x1B, 0x82, 0xEF, 0xFC, 0x3F, 0xF8, 0x30, 0x70, 0xC0, 0xC3, 0x03,
+  0x0C, 0x1C, 0x3F, 0xE0, 0xFE, 0x03, 0x1C, 0x0C, 0x38, 0x30, 0x60, 0xC1, 0xCF, 0xE3, 0xFF, 0x87,
+  0x1B, 0x86, 0xA3, 0xED, 0xFF, 0xE1, 0xF0, 0x3C, 0x0F, 0xC0, 0x7E, 0x07, 0xE0, 0x3F, 0x03, 0xC0,
+  0xF8, 0x7F, 0xFB, 0x7C, 0x1B, 0x84, 0xCF, 0xFF, 0xFF, 0xFC, 0x63, 0xC6, 0x3C, 0x63, 0xC6, 0x30,
+  0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x03, 0xFC, 0x3F, 0xC0, 0x1B, 0x82, 0xEF, 0xCF,
+  0xFF, 0x3F, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C,
+  0x30, 0x30, 0x61, 0x81, 0xFE, 0x01, 0xE0, 0x1B, 0x82, 0xFF, 0xEF, 0xFF, 0xDF, 0xCC, 0x06, 0x0C,
+  0x18, 0x18, 0x30, 0x30, 0x60, 0x31, 0x80, 0x63, 0x00, 0x6C, 0x00, 0xD8, 0x01, 0xB0, 0x01, 0xC0,
+  0x03, 0x80, 0x02, 0x00, 0x1B, 0x81, 0x1F, 0xE3, 0xFF, 0xF1, 0xFC, 0xC0, 0x18, 0x60, 0x0C, 0x30,
+  0x86, 0x0C, 0xE6, 0x06, 0x73, 0x03, 0x6D, 0x81, 0xB6, 0xC0, 0xF3, 0xE0, 0x38, 0xE0, 0x1C, 0x70,
+  0x0C, 0x18, 0x06, 0x0C, 0x00, 0x1B, 0x82, 0xEF, 0xCF, 0xFF, 0x3F, 0x30, 0x30, 0x61, 0x80, 0xCC,
+  0x01, 0xE0, 0x03, 0x00, 0x0C, 0x00, 0x78, 0x03, 0x30, 0x18, 0x60, 0xC0, 0xCF, 0xCF, 0xFF, 0x3F,
+  0x1B, 0x82, 0xEF, 0x8F, 0xFE, 0x3F, 0x30, 0x30, 0x61, 0x80, 0xCC, 0x03, 0x30, 0x07, 0x80, 0x0C,
+  0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x01, 0xFE, 0x07, 0xF8, 0x1B, 0x84, 0xB7, 0xFE, 0xFF,
+  0xD8, 0x1B, 0x06, 0x61, 0x8C, 0x60, 0x18, 0x06, 0x01, 0x86, 0x60, 0xD8, 0x1E, 0x03, 0xFF, 0xFF,
+  0xFC, 0x14, 0x8E, 0x5F, 0xFF, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8F, 0xFC, 0x05,
+  0x06, 0xAC, 0x03, 0x00, 0xE0, 0x18, 0x07, 0x00, 0xC0, 0x30, 0x06, 0x01, 0x80, 0x30, 0x0C, 0x01,
+  0x80, 0x60, 0x0C, 0x03, 0x00, 0xE0, 0x18, 0x07, 0x00, 0xC0, 0x30, 0x14, 0x88, 0x5F, 0xFC, 0x63,
+  0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x3F, 0xFC, 0x0A, 0x06, 0xB0, 0x40, 0x1C, 0x07, 0xC1,
+  0xDC, 0x31, 0x8C, 0x1B, 0x01, 0xC0, 0x10, 0xB0, 0x81, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x09, 0x0C,
+  0x5C, 0x70, 0xE3, 0x32, 0xC4, 0xC3, 0xF0, 0x7F, 0x80, 0x0C, 0x00, 0xC1, 0xFC, 0x7F, 0xCE, 0x0C,
+  0xC0, 0xCC, 0x1C, 0x7F, 0xF3, 0xEF, 0x13, 0xC2, 0xDF, 0x00, 0x78, 0x00, 0xC0, 0x06, 0x00, 0x37,
+  0xC1, 0xFF, 0x8E, 0x0C, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x66, 0x03, 0x38, 0x37, 0xFF, 0xBD,
+  0xF0, 0x32, 0xC4, 0xC0, 0xFB, 0x3F, 0xF7, 0x07, 0xE0, 0x3C, 0x03, 0xC0, 0x0C, 0x00, 0xE0, 0x37,
+  0x07, 0x3F, 0xE0, 0xFC, 0x13, 0xC4, 0xD0, 0x1E, 0x00, 0xF0, 0x01, 0x80, 0x0C, 0x1F, 0x63, 0xFF,
+  0x18, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0C, 0x60, 0xE3, 0xFF, 0xC7, 0xDE, 0x32,
+  0xC4, 0xC1, 0xF8, 0x7F, 0xE6, 0x06, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xC0, 0x06, 0x03, 0x7F,
+  0xF1, 0xFC, 0x13, 0xC4, 0xC0, 0x7F, 0x0F, 0xF1, 0x80, 0x18, 0x0F, 0xFE, 0xFF, 0xE1, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0xFF, 0xCF, 0xFC, 0x34, 0x04, 0xD1, 0xF7, 0xBF,
+  0xFD, 0x83, 0x98, 0x0C, 0xC0, 0x66, 0x03, 0x30, 0x19, 0x80, 0xC6, 0x0E, 0x3F, 0xF0, 0x7D, 0x80,
+  0x0C, 0x00, 0x60, 0x07, 0x0F, 0xF0, 0x7E, 0x00, 0x13, 0xC2, 0xEF, 0x00, 0x3C, 0x00, 0x30, 0x00,
+  0xC0, 0x03, 0x7C, 0x0F, 0xF8, 0x38, 0x70, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3,
+  0x03, 0x3F, 0x3F, 0xFC, 0xFC, 0x13, 0xC4, 0xC0, 0x60, 0x06, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x7E,
+  0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x15, 0x06,
+  0x90, 0x60, 0x30, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80,
+  0xC0, 0x60, 0x30, 0x18, 0x1F, 0xFD, 0xF8, 0x13, 0xC4, 0xCF, 0x00, 0xF0, 0x03, 0x00, 0x30, 0x03,
+  0x3E, 0x33, 0xE3, 0x30, 0x36, 0x03, 0xE0, 0x3C, 0x03, 0xE0, 0x37, 0x03, 0x38, 0xF1, 0xFF, 0x1F,
+  0x13, 0xC4, 0xC7, 0xE0, 0x7E, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+  0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x32, 0xC1, 0x0F, 0x77, 0x8F, 0xFF, 0xC3,
+  0x9C, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xCF, 0xDE, 0xFF,
+  0xDE, 0xF0, 0x32, 0xC2, 0xEF, 0x7C, 0x3F, 0xF8, 0x38, 0x70, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30,
+  0x30, 0xC0, 0xC3, 0x03, 0x3F, 0x3F, 0xFC, 0xFC, 0x32, 0xC4, 0xC0, 0xF0, 0x3F, 0xC7, 0x0E, 0xE0,
+  0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xE0, 0x77, 0x0E, 0x3F, 0xC0, 0xF0, 0x34, 0x02, 0xDF, 0x7C, 0x7F,
+  0xF8, 0xE0, 0xC6, 0x03, 0x30, 0x19, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x83, 0x1F, 0xF8, 0xDF, 0x06,
+  0x00, 0x30, 0x01, 0x80, 0x3F, 0x81, 0xFC, 0x00, 0x34, 0x04, 0xD1, 0xF7, 0xBF, 0xFD, 0x83, 0x98,
+  0x0C, 0xC0, 0x66, 0x03, 0x30, 0x19, 0x80, 0xC6, 0x0E, 0x3F, 0xF0, 0x7D, 0x80, 0x0C, 0x00, 0x60,
+  0x03, 0x00, 0xFE, 0x07, 0xF0, 0x32, 0xC4, 0xCF, 0x9E, 0xFB, 0xF1, 0xF3, 0x1C, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x18, 0x01, 0x80, 0xFF, 0xCF, 0xFC, 0x32, 0xC6, 0xA3, 0xFD, 0xFF, 0xC0, 0xF0, 0x3F,
+  0xC1, 0xFE, 0x07, 0xF0, 0x3C, 0x1F, 0xFE, 0xFF, 0x00, 0x13, 0xC4, 0xC3, 0x00, 0x30, 0x03, 0x00,
+  0x30, 0x0F, 0xFC, 0xFF, 0xC3, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x07, 0x1F,
+  0xF0, 0xFC, 0x32, 0xC2, 0xEF, 0x0F, 0x3C, 0x3C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30,
+  0x30, 0xC0, 0xC3, 0x07, 0x07, 0xFF, 0x0F, 0xBC, 0x32, 0xC2, 0xEF, 0x87, 0xFE, 0x1F, 0x30, 0x30,
+  0xC0, 0xC1, 0x86, 0x06, 0x18, 0x0C, 0xC0, 0x33, 0x00, 0xFC, 0x01, 0xE0, 0x07, 0x80, 0x32, 0xC2,
+  0xDF, 0x07, 0xF8, 0x3D, 0x88, 0xCC, 0xE6, 0x67, 0x31, 0xAB, 0x0F, 0x78, 0x7B, 0xC3, 0x8C, 0x0C,
+  0x60, 0x63, 0x00, 0x32, 0xC4, 0xCF, 0x9F, 0xF9, 0xF3, 0x0C, 0x19, 0x80, 0xF0, 0x06, 0x00, 0xF0,
+  0x19, 0x83, 0x0C, 0xF9, 0xFF, 0x9F, 0x34, 0x02, 0xFF, 0xC3, 0xFF, 0x87, 0xCC, 0x06, 0x0C, 0x18,
+  0x18, 0x30, 0x18, 0xC0, 0x31, 0x80, 0x36, 0x00, 0x7C, 0x00, 0x70, 0x00, 0x60, 0x01, 0x80, 0x03,
+  0x00, 0x0C, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0x32, 0xC6, 0xAF, 0xFF, 0xFF, 0xC1, 0xB0, 0xC0, 0x60,
+  0x30, 0x18, 0x0C, 0x36, 0x0F, 0xFF, 0xFF, 0xC0, 0x14, 0x8A, 0x61, 0xCF, 0x30, 0xC3, 0x0C, 0x30,
+  0xC7, 0x38, 0x70, 0xC3, 0x0C, 0x30, 0xC3, 0xC7, 0x14, 0x8E, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x14,
+  0x8A, 0x6E, 0x3C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x87, 0x38, 0xC3, 0x0C, 0x30, 0xCF, 0x38, 0x41,
+  0x44, 0xB3, 0x80, 0xF8, 0xFB, 0xBE, 0x3E, 0x03, 0x80,
+};
+
+static const uint16_t Font24_Offsets[95] =
+{
+  0, 2, 11, 21, 46, 70, 92, 113, 119, 135, 151, 166,
+  187, 194, 199, 203, 231, 253, 275, 299, 321, 345, 369, 391,
+  413, 435, 457, 465, 478, 504, 517, 543, 562, 586, 617, 643,
+  667, 693, 717, 741, 767, 794, 814, 840, 869, 895, 926, 953,
+  977, 1001, 1029, 1056, 1076, 1100, 1127, 1156, 1189, 1216, 1243, 1265,
+  1279, 1307, 1321, 1335, 1342, 1347, 1366, 1393, 1412, 1439, 1458, 1483,
+  1512, 1541, 1566, 1591, 1616, 1641, 1666, 1688, 1707, 1736, 1765, 1784,
+  1801, 1826, 1848, 1870, 1891, 1910, 1943, 1960, 1976, 1983, 1999,
+};
+
+sFONT Font24 = {
+  0, /* Decoded on first use */
+  17, /* Width */
+  24, /* Height */
+  Font24_Packed,
+  Font24_Offsets,
+};
+
+#endif /* FONTS_PACKED */
@@ -18,20 +18,332 @@
 
 #include "LCD_DISCO_F429ZI.h"
 
-#define LCD_FRAME_BUFFER_LAYER0                  (LCD_FRAME_BUFFER+0x130000)
-#define LCD_FRAME_BUFFER_LAYER1                  LCD_FRAME_BUFFER
-#define CONVERTED_FRAME_BUFFER                   (LCD_FRAME_BUFFER+0x260000)
+// Layer-0 palette: the LCD_COLOR_ set plus grey steps for blended text
+static const uint32_t Layer0Palette[] =
+{
+  LCD_COLOR_WHITE, LCD_COLOR_BLACK, LCD_COLOR_LIGHTGRAY, LCD_COLOR_GRAY, LCD_COLOR_DARKGRAY,
+  0xFFEEEEEE, 0xFFB0B0B0, 0xFF606060, 0xFF202020,
+  LCD_COLOR_BLUE, LCD_COLOR_GREEN, LCD_COLOR_RED, LCD_COLOR_CYAN, LCD_COLOR_MAGENTA, LCD_COLOR_YELLOW,
+  LCD_COLOR_LIGHTBLUE, LCD_COLOR_LIGHTGREEN, LCD_COLOR_LIGHTRED, LCD_COLOR_LIGHTCYAN, LCD_COLOR_LIGHTMAGENTA, LCD_COLOR_LIGHTYELLOW,
+  LCD_COLOR_DARKBLUE, LCD_COLOR_DARKGREEN, LCD_COLOR_DARKRED, LCD_COLOR_DARKCYAN, LCD_COLOR_DARKMAGENTA, LCD_COLOR_DARKYELLOW,
+  LCD_COLOR_BROWN, LCD_COLOR_ORANGE
+};
+
+// Surface primitives, one instance per pixel type (uint8_t, uint16_t, uint32_t)
+
+// Bresenham line; unclipped stores when both ends are inside the clip rectangle
+template <typename P>
+static void SurfaceLine(const Surface &s, int x1, int y1, int x2, int y2, P value)
+{
+  int dx = x2 > x1 ? x2 - x1 : x1 - x2;
+  int dy = y2 > y1 ? y2 - y1 : y1 - y2;
+  int sx = x2 >= x1 ? 1 : -1;
+  int sy = y2 >= y1 ? 1 : -1;
+  int err = dx - dy, e2;
+
+  if (!s.Contains(x1, y1) || !s.Contains(x2, y2))
+  {
+    for (;;)
+    {
+      s.Pixel<P>(x1, y1, value);
+      if (x1 == x2 && y1 == y2)
+        break;
+      e2 = 2 * err;
+      if (e2 > -dy) { err -= dy; x1 += sx; }
+      if (e2 < dx) { err += dx; y1 += sy; }
+    }
+    return;
+  }
+
+  P *p = s.At<P>(x1, y1);
+  int px = sx, py = sy * s.Pitch();
+  for (int n = (dx > dy ? dx : dy); ; n--)
+  {
+    *p = value;
+    if (n == 0)
+      break;
+    e2 = 2 * err;
+    if (e2 > -dy) { err -= dy; p += px; }
+    if (e2 < dx) { err += dx; p += py; }
+  }
+}
+
+// Closed poly-line, drawn like BSP_LCD_DrawPolygon
+template <typename P>
+static void SurfacePolygon(const Surface &s, pPoint points, uint16_t count, P value)
+{
+  if (count < 2)
+    return;
+  SurfaceLine<P>(s, points[0].X, points[0].Y, points[count - 1].X, points[count - 1].Y, value);
+  for (int i = 1; i < count; i++)
+    SurfaceLine<P>(s, points[i - 1].X, points[i - 1].Y, points[i].X, points[i].Y, value);
+}
+
+// Midpoint circle, same pixels as BSP_LCD_DrawCircle
+template <typename P>
+static void SurfaceCircle(const Surface &s, int x0, int y0, int r, P value)
+{
+  int d = 3 - 2 * r;
+  int x = 0, y = r;
+  int pitch = s.Pitch();
+  bool inside = s.Contains(x0 - r, y0 - r, x0 + r + 1, y0 + r + 1);
+  P *c = s.At<P>(x0, y0);
+
+  while (x <= y)
+  {
+    if (inside)
+    {
+      c[x - y * pitch] = value;
+      c[-x - y * pitch] = value;
+      c[y - x * pitch] = value;
+      c[-y - x * pitch] = value;
+      c[x + y * pitch] = value;
+      c[-x + y * pitch] = value;
+      c[y + x * pitch] = value;
+      c[-y + x * pitch] = value;
+    }
+    else
+    {
+      s.Pixel<P>(x0 + x, y0 - y, value);
+      s.Pixel<P>(x0 - x, y0 - y, value);
+      s.Pixel<P>(x0 + y, y0 - x, value);
+      s.Pixel<P>(x0 - y, y0 - x, value);
+      s.Pixel<P>(x0 + x, y0 + y, value);
+      s.Pixel<P>(x0 - x, y0 + y, value);
+      s.Pixel<P>(x0 + y, y0 + x, value);
+      s.Pixel<P>(x0 - y, y0 + x, value);
+    }
+
+    if (d < 0)
+    {
+      d += 4 * x + 6;
+    }
+    else
+    {
+      d += 4 * (x - y) + 10;
+      y--;
+    }
+    x++;
+  }
+}
+
+// Blends of the line color by coverage level, from the background (0) to the color (LCD_AA_LEVELS - 1)
+struct BlendARGB8888
+{
+  uint32_t color;
+  uint16_t alpha[LCD_AA_LEVELS]; // Coverage of each level, 0..256
+
+  void operator()(uint32_t *p, int level) const
+  {
+    uint32_t back = *p, a = alpha[level];
+    uint32_t rb = (((color & 0x00FF00FF) * a + (back & 0x00FF00FF) * (256 - a)) >> 8) & 0x00FF00FF;
+    uint32_t g = (((color & 0x0000FF00) * a + (back & 0x0000FF00) * (256 - a)) >> 8) & 0x0000FF00;
+    *p = (back & 0xFF000000) | rb | g;
+  }
+};
+
+struct BlendRGB565
+{
+  uint16_t color;
+  uint8_t alpha[LCD_AA_LEVELS]; // Coverage of each level, 0..32
+
+  void operator()(uint16_t *p, int level) const
+  {
+    // Spread the channels apart so one multiply blends all three: -g-r-b with 5 spare bits each
+    uint32_t back = *p, a = alpha[level];
+    uint32_t b = (back | (back << 16)) & 0x07E0F81F;
+    uint32_t f = (color | (color << 16)) & 0x07E0F81F;
+    b = (b + (((f - b) * a) >> 5)) & 0x07E0F81F;
+    *p = (uint16_t)(b | (b >> 16));
+  }
+};
+
+struct BlendL8
+{
+  const uint8_t (*table)[LCD_AA_LEVELS]; // Palette index of each background index and level
+
+  void operator()(uint8_t *p, int level) const { *p = table[*p][level]; }
+};
+
+// L8 blend table of the last color and palette
+static uint8_t BlendTableL8[256][LCD_AA_LEVELS];
+static const uint32_t *BlendTablePalette = NULL;
+static uint32_t BlendTableColor = 0;
+
+// Wu line: per major-axis step, the two pixels straddling the line share the
+// coverage by the fractional minor coordinate (16.16 fixed point)
+template <typename P, typename Blend>
+static void SurfaceLineAA(const Surface &s, int x1, int y1, int x2, int y2, const Blend &blend)
+{
+  int dx = x2 > x1 ? x2 - x1 : x1 - x2;
+  int dy = y2 > y1 ? y2 - y1 : y1 - y2;
+  bool steep = dy > dx;
+  int major, n, t;
+  int32_t minor, gradient;
+  int xmin = x1 < x2 ? x1 : x2, xmax = x1 < x2 ? x2 : x1;
+  int ymin = y1 < y2 ? y1 : y2, ymax = y1 < y2 ? y2 : y1;
+  bool inside = s.Contains(xmin, ymin, xmax + 2, ymax + 2);
+
+  // Walk the major axis upwards
+  if ((steep && y1 > y2) || (!steep && x1 > x2))
+  {
+    t = x1; x1 = x2; x2 = t;
+    t = y1; y1 = y2; y2 = t;
+  }
+  n = steep ? y2 - y1 : x2 - x1;
+  major = steep ? y1 : x1;
+  minor = (steep ? x1 : y1) << 16;
+  gradient = n ? (int32_t)(((int64_t)((steep ? x2 - x1 : y2 - y1)) << 16) / n) : 0;
+
+  for (int i = 0; i <= n; i++, major++, minor += gradient)
+  {
+    int m = minor >> 16;
+    int level = ((minor & 0xFFFF) * LCD_AA_LEVELS) >> 16; // Coverage of the second pixel
+    int x = steep ? m : major, y = steep ? major : m;
+    int x2nd = steep ? x + 1 : x, y2nd = steep ? y : y + 1;
+
+    if (inside || s.Contains(x, y))
+      blend(s.At<P>(x, y), LCD_AA_LEVELS - 1 - level);
+    if (level && (inside || s.Contains(x2nd, y2nd)))
+      blend(s.At<P>(x2nd, y2nd), level);
+  }
+}
+
+// Edge of the scanline edge table: rows y0 <= y < y1, x in 16.16 fixed point on the current row
+typedef struct
+{
+  int y0, y1;
+  int32_t x, dx;
+} EdgeTypeDef;
+
+// Scanline polygon fill, even-odd rule. Pixel centres are at integer
+// coordinates; a row gets the pixels from the left crossing (rounded up) to
+// before the right one, so left and top edges are in and right and bottom
+// edges out. Spans go to the DMA2D when queued, else straight to the surface.
+template <typename P>
+static void SurfaceFillPolygon(const Surface &s, const Point *points, int count, P value, bool queued)
+{
+  EdgeTypeDef edges[LCD_POLYGON_MAX];
+  EdgeTypeDef *active[LCD_POLYGON_MAX];
+  int n = 0, next = 0, live = 0;
+  int y, yend = 0, i, j;
+
+  // Edge table sorted by first row; horizontal edges cross no row
+  for (i = 0; i < count; i++)
+  {
+    const Point &a = points[i];
+    const Point &b = points[(i + 1) % count];
+    if (a.Y == b.Y)
+      continue;
+    const Point &top = a.Y < b.Y ? a : b;
+    const Point &bottom = a.Y < b.Y ? b : a;
+    EdgeTypeDef e;
+    e.y0 = top.Y;
+    e.y1 = bottom.Y;
+    e.dx = (int32_t)(((int64_t)(bottom.X - top.X) << 16) / (bottom.Y - top.Y));
+    e.x = (int32_t)top.X << 16;
+    if (e.y1 > yend)
+      yend = e.y1;
+    for (j = n++; j > 0 && edges[j - 1].y0 > e.y0; j--)
+      edges[j] = edges[j - 1];
+    edges[j] = e;
+  }
+  if (n == 0)
+    return;
+
+  y = edges[0].y0 > s.ClipY0() ? edges[0].y0 : s.ClipY0();
+  if (yend > s.ClipY1())
+    yend = s.ClipY1();
+
+  for (; y < yend; y++)
+  {
+    // Activate the edges reaching this row, stepped past rows above the clip rectangle
+    for (; next < n && edges[next].y0 <= y; next++)
+    {
+      if (edges[next].y1 <= y)
+        continue;
+      edges[next].x += edges[next].dx * (y - edges[next].y0);
+      active[live++] = &edges[next];
+    }
+
+    // Drop finished edges and keep the rest ordered by x (insertion sort: the order rarely changes)
+    for (i = 0, j = 0; i < live; i++)
+    {
+      if (active[i]->y1 > y)
+        active[j++] = active[i];
+    }
+    live = j;
+    for (i = 1; i < live; i++)
+    {
+      EdgeTypeDef *e = active[i];
+      for (j = i; j > 0 && active[j - 1]->x > e->x; j--)
+        active[j] = active[j - 1];
+      active[j] = e;
+    }
+
+    // One span between each pair of crossings
+    for (i = 0; i + 1 < live; i += 2)
+    {
+      int x0 = (active[i]->x + 0xFFFF) >> 16;
+      int x1 = (active[i + 1]->x + 0xFFFF) >> 16;
+      if (x0 < s.ClipX0())
+        x0 = s.ClipX0();
+      if (x1 > s.ClipX1())
+        x1 = s.ClipX1();
+      if (x0 >= x1)
+        continue;
+      if (queued)
+        BSP_LCD_FillRect(x0, y, x1 - x0, 1);
+      else
+        s.Span<P>(x0, x1, y, value);
+    }
+
+    for (i = 0; i < live; i++)
+      active[i]->x += active[i]->dx;
+  }
+}
+
+// 1-bpp font character; the clip is applied once to the row and column range
+template <typename P>
+static void SurfaceChar(const Surface &s, int x, int y, sFONT *font, uint8_t ascii, P text, P back)
+{
+  int bytes = (font->Width + 7) / 8;
+  const uint8_t *c = BSP_LCD_GetGlyph(font, ascii);
+  int j0 = s.ClipX0() > x ? s.ClipX0() - x : 0;
+  int j1 = s.ClipX1() < x + font->Width ? s.ClipX1() - x : font->Width;
+  int i0 = s.ClipY0() > y ? s.ClipY0() - y : 0;
+  int i1 = s.ClipY1() < y + font->Height ? s.ClipY1() - y : font->Height;
+
+  for (int i = i0; i < i1; i++)
+  {
+    const uint8_t *line = c + i * bytes;
+    P *p = s.At<P>(x + j0, y + i);
+    for (int j = j0; j < j1; j++)
+      *p++ = (line[j >> 3] & (0x80 >> (j & 7))) ? text : back;
+  }
+}
 
 // Constructor
-LCD_DISCO_F429ZI::LCD_DISCO_F429ZI()
+LCD_DISCO_F429ZI::LCD_DISCO_F429ZI() : LabelCount(0), Presenting(false)
 {
   BSP_LCD_Init();  
-  BSP_LCD_LayerDefaultInit(1, LCD_FRAME_BUFFER_LAYER1);
-  BSP_LCD_SelectLayer(1);
-  BSP_LCD_Clear(LCD_COLOR_WHITE);  
-  BSP_LCD_SetColorKeying(1, LCD_COLOR_WHITE);
-  BSP_LCD_SetLayerVisible(1, DISABLE);
-  BSP_LCD_LayerDefaultInit(0, LCD_FRAME_BUFFER_LAYER0);
+  XSize = BSP_LCD_GetXSize();
+  YSize = BSP_LCD_GetYSize();
+  ResetClipRect();
+  BSP_LCD_LayerDefaultInit(LCD_CHROME_LAYER, LCD_FRAME_BUFFER_LAYER1);
+  BSP_LCD_SelectLayer(LCD_CHROME_LAYER);
+  BSP_LCD_Clear(LCD_CHROME_KEY);  
+  BSP_LCD_SetColorKeying(LCD_CHROME_LAYER, LCD_CHROME_KEY);
+  BSP_LCD_SetLayerVisible(LCD_CHROME_LAYER, DISABLE);
+  for (int i = 0; i < LCD_LAYER0_BUFFERS; i++)
+  {
+    Layer0Buffers[i] = BSP_SDRAM_Alloc(BSP_LCD_GetXSize() * BSP_LCD_GetYSize() * BSP_LCD_GetPixelSize(LCD_LAYER0_FORMAT));
+  }
+  BSP_LCD_LayerInit(0, Layer0Buffers[0], LCD_LAYER0_FORMAT);
+  if (LCD_LAYER0_FORMAT == LTDC_PIXEL_FORMAT_L8)
+  {
+    BSP_LCD_SetPalette(0, Layer0Palette, sizeof(Layer0Palette) / sizeof(Layer0Palette[0]));
+  }
   BSP_LCD_SelectLayer(0);
   BSP_LCD_SetFont(&Font16);
   BSP_LCD_DisplayOn();
@@ -68,6 +380,17 @@ void LCD_DISCO_F429ZI::LayerDefaultInit(uint16_t LayerIndex, uint32_t FB_Address
   BSP_LCD_LayerDefaultInit(LayerIndex, FB_Address);
 }
 
+void LCD_DISCO_F429ZI::LayerInit(uint16_t LayerIndex, uint32_t FB_Address, uint32_t PixelFormat)
+{
+  BSP_LCD_LayerInit(LayerIndex, FB_Address, PixelFormat);
+}
+
+void LCD_DISCO_F429ZI::SetPalette(uint32_t LayerIndex, const uint32_t *pColors, uint32_t Count)
+{
+  BSP_LCD_SetPalette(LayerIndex, pColors, Count);
+  BlendTablePalette = NULL; /* The contents may have changed */
+}
+
 void LCD_DISCO_F429ZI::SelectLayer(uint32_t LayerIndex)
 {
   BSP_LCD_SelectLayer(LayerIndex);
@@ -93,6 +416,11 @@ void LCD_DISCO_F429ZI::SetLayerWindow(uint16_t LayerIndex, uint16_t Xpos, uint16
   BSP_LCD_SetLayerWindow(LayerIndex, Xpos, Ypos, Width, Height);
 }
 
+void LCD_DISCO_F429ZI::SetLayerPitch(uint32_t LayerIndex, uint32_t Pitch)
+{
+  BSP_LCD_SetLayerPitch(LayerIndex, Pitch);
+}
+
 void LCD_DISCO_F429ZI::SetColorKeying(uint32_t LayerIndex, uint32_t RGBValue)
 {
   BSP_LCD_SetColorKeying(LayerIndex, RGBValue);
@@ -141,6 +469,7 @@ uint32_t LCD_DISCO_F429ZI::ReadPixel(uint16_t Xpos, uint16_t Ypos)
 void LCD_DISCO_F429ZI::Clear(uint32_t Color)
 {
   BSP_LCD_Clear(Color);
+  InvalidateLabels();
 }
 
 void LCD_DISCO_F429ZI::ClearStringLine(uint32_t Line)
@@ -150,7 +479,35 @@ void LCD_DISCO_F429ZI::ClearStringLine(uint32_t Line)
 
 void LCD_DISCO_F429ZI::DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii)
 {
-  BSP_LCD_DisplayChar(Xpos, Ypos, Ascii);
+  sFONT *font = BSP_LCD_GetFont();
+  Surface surface = GetSurface();
+  uint32_t layer = BSP_LCD_GetActiveLayer();
+  uint32_t text, back;
+
+  if (surface.Contains(Xpos, Ypos, Xpos + font->Width, Ypos + font->Height))
+  {
+    BSP_LCD_DisplayChar(Xpos, Ypos, Ascii);
+    return;
+  }
+
+  /* Partly clipped: rasterize the visible part */
+  text = BSP_LCD_ConvertColor(layer, BSP_LCD_GetTextColor());
+  back = BSP_LCD_ConvertColor(layer, BSP_LCD_GetBackColor());
+  BSP_LCD_WaitForTransfer();
+  switch (surface.PixelSize())
+  {
+  case 4:
+    SurfaceChar<uint32_t>(surface, Xpos, Ypos, font, Ascii, text, back);
+    break;
+  case 2:
+    SurfaceChar<uint16_t>(surface, Xpos, Ypos, font, Ascii, text, back);
+    break;
+  case 1:
+    SurfaceChar<uint8_t>(surface, Xpos, Ypos, font, Ascii, text, back);
+    break;
+  default:
+    break; /* RGB888 has no pixel type: clipped characters are left out */
+  }
 }
 
 void LCD_DISCO_F429ZI::DisplayStringAt(uint16_t X, uint16_t Y, uint8_t *pText, Text_AlignModeTypdef mode)
@@ -163,6 +520,179 @@ void LCD_DISCO_F429ZI::DisplayStringAtLine(uint16_t Line, uint8_t *ptr)
   BSP_LCD_DisplayStringAtLine(Line, ptr);
 }
 
+uint8_t LCD_DISCO_F429ZI::CreateFontA8(sFONT *pSource, uint16_t Scale, sFONTA8 *pFont)
+{
+  return BSP_LCD_CreateFontA8(pSource, Scale, pFont);
+}
+
+void LCD_DISCO_F429ZI::DisplayStringAtA8(uint16_t X, uint16_t Y, sFONTA8 *pFont, uint8_t *pText, Text_AlignModeTypdef mode)
+{
+  BSP_LCD_DisplayStringAtA8(X, Y, pFont, pText, mode);
+}
+
+uint32_t LCD_DISCO_F429ZI::GetFence(void)
+{
+  return BSP_LCD_GetFence();
+}
+
+void LCD_DISCO_F429ZI::WaitForFence(uint32_t Fence)
+{
+  BSP_LCD_WaitForFence(Fence);
+}
+
+uint8_t LCD_DISCO_F429ZI::EnableSwapChain(void)
+{
+  for (int i = 0; i < LCD_LAYER0_BUFFERS; i++)
+  {
+    if (Layer0Buffers[i] == 0)
+    {
+      return LCD_ERROR;
+    }
+  }
+  if (BSP_LCD_SwapChainInit(0, Layer0Buffers, LCD_LAYER0_BUFFERS) != LCD_OK)
+  {
+    return LCD_ERROR;
+  }
+  Presenting = true;
+  return LCD_OK;
+}
+
+void LCD_DISCO_F429ZI::Present(void)
+{
+  BSP_LCD_Present();
+}
+
+void LCD_DISCO_F429ZI::BeginChrome(void)
+{
+  /* Not shown while it is redrawn. Hidden at the vertical blanking, which also latches a
+     frame the swap chain presented; an immediate reload could latch its address mid-scan */
+  BSP_LCD_SetLayerVisible_NoReload(LCD_CHROME_LAYER, DISABLE);
+  BSP_LCD_Relaod(LCD_RELOAD_VERTICAL_BLANKING);
+  BSP_LCD_WaitForReload();
+  BSP_LCD_SelectLayer(LCD_CHROME_LAYER);
+  BSP_LCD_Clear(LCD_CHROME_KEY);
+  BSP_LCD_SetBackColor(LCD_CHROME_KEY);
+}
+
+void LCD_DISCO_F429ZI::EndChrome(void)
+{
+  BSP_LCD_SelectLayer(0);
+
+  /* The swap chain reloads the shadow registers when it latches a frame */
+  BSP_LCD_SetLayerVisible_NoReload(LCD_CHROME_LAYER, ENABLE);
+  if (!Presenting)
+  {
+    BSP_LCD_Relaod(LCD_RELOAD_VERTICAL_BLANKING);
+  }
+}
+
+void LCD_DISCO_F429ZI::ClearChrome(void)
+{
+  BSP_LCD_SetLayerVisible_NoReload(LCD_CHROME_LAYER, DISABLE);
+  if (!Presenting)
+  {
+    BSP_LCD_Relaod(LCD_RELOAD_VERTICAL_BLANKING);
+  }
+}
+
+void LCD_DISCO_F429ZI::DisplayLabelAt(uint16_t X, uint16_t Y, uint8_t *pText, Text_AlignModeTypdef mode)
+{
+  sFONT *font = BSP_LCD_GetFont();
+  uint32_t textcolor = BSP_LCD_GetTextColor();
+  uint32_t backcolor = BSP_LCD_GetBackColor();
+  uint32_t xsize = BSP_LCD_GetXSize() / font->Width;
+  uint32_t size = 0, i;
+  uint16_t column;
+  LabelTypeDef *label = NULL;
+
+  /* Get the text size, limited to the characters that fit on a line */
+  while (pText[size] != 0) size++;
+  if (size > xsize) size = xsize;
+
+  /* Same alignment as BSP_LCD_DisplayStringAt */
+  switch (mode)
+  {
+  case CENTER_MODE:
+    column = X + ((xsize - size) * font->Width) / 2;
+    break;
+  case RIGHT_MODE:
+    column = X + ((xsize - size) * font->Width);
+    break;
+  default:
+    column = X;
+    break;
+  }
+
+  /* Find the label drawn at this position before */
+  for (i = 0; i < LabelCount; i++)
+  {
+    if (Labels[i].X == X && Labels[i].Y == Y && Labels[i].Mode == mode)
+    {
+      label = &Labels[i];
+      break;
+    }
+  }
+
+  if (size >= LCD_LABEL_LENGTH || (label == NULL && LabelCount >= LCD_LABEL_MAX))
+  {
+    /* Cannot be tracked: draw everything */
+    BSP_LCD_DisplayStringAt(X, Y, pText, mode);
+    if (label != NULL)
+    {
+      *label = Labels[--LabelCount];
+    }
+    return;
+  }
+
+  if (label != NULL && (label->pFont != font || label->TextColor != textcolor || label->BackColor != backcolor ||
+                        label->Column != column))
+  {
+    /* Different style, or the text moved (centered or right aligned text changed length): every cell
+       changes, and the old extent, in the old font's cells, may reach past the new text */
+    BSP_LCD_SetTextColor(backcolor);
+    BSP_LCD_FillRect(label->Column, Y, label->Length * label->pFont->Width, label->pFont->Height);
+    BSP_LCD_SetTextColor(textcolor);
+    label->Length = 0;
+  }
+  else if (label == NULL)
+  {
+    label = &Labels[LabelCount++];
+    label->X = X;
+    label->Y = Y;
+    label->Mode = mode;
+    label->Length = 0;
+  }
+
+  /* Redraw only the cells whose character changed */
+  for (i = 0; i < size; i++)
+  {
+    if (i >= label->Length || label->Text[i] != (char)pText[i])
+    {
+      DisplayChar(column + i * font->Width, Y, pText[i]);
+      label->Text[i] = pText[i];
+    }
+  }
+
+  /* Clear the cells of a longer previous text */
+  if (label->Length > size)
+  {
+    BSP_LCD_SetTextColor(backcolor);
+    BSP_LCD_FillRect(column + size * font->Width, Y, (label->Length - size) * font->Width, font->Height);
+    BSP_LCD_SetTextColor(textcolor);
+  }
+
+  label->Column = column;
+  label->pFont = font;
+  label->TextColor = textcolor;
+  label->BackColor = backcolor;
+  label->Length = size;
+}
+
+void LCD_DISCO_F429ZI::InvalidateLabels(void)
+{
+  LabelCount = 0;
+}
+
 void LCD_DISCO_F429ZI::DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
 {
   BSP_LCD_DrawHLine(Xpos, Ypos, Length);
@@ -175,7 +705,81 @@ void LCD_DISCO_F429ZI::DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
 
 void LCD_DISCO_F429ZI::DrawLine(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2)
 {
-  BSP_LCD_DrawLine(X1, Y1, X2, Y2);
+  Surface surface = GetSurface();
+  uint32_t value = BSP_LCD_ConvertColor(BSP_LCD_GetActiveLayer(), BSP_LCD_GetTextColor());
+
+  BSP_LCD_WaitForTransfer();
+  switch (surface.PixelSize())
+  {
+  case 4:
+    SurfaceLine<uint32_t>(surface, X1, Y1, X2, Y2, value);
+    break;
+  case 2:
+    SurfaceLine<uint16_t>(surface, X1, Y1, X2, Y2, value);
+    break;
+  case 1:
+    SurfaceLine<uint8_t>(surface, X1, Y1, X2, Y2, value);
+    break;
+  default:
+    BSP_LCD_DrawLine(X1, Y1, X2, Y2); /* RGB888, unclipped */
+    break;
+  }
+}
+
+void LCD_DISCO_F429ZI::DrawLineAA(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2)
+{
+  Surface surface = GetSurface();
+  uint32_t layer = BSP_LCD_GetActiveLayer();
+  uint32_t color = BSP_LCD_GetTextColor();
+  const uint32_t *palette;
+  uint32_t count, back, a;
+  int i, level;
+
+  BSP_LCD_WaitForTransfer();
+  if (surface.Format() == LTDC_PIXEL_FORMAT_ARGB8888)
+  {
+    BlendARGB8888 blend;
+    blend.color = color;
+    for (level = 0; level < LCD_AA_LEVELS; level++)
+      blend.alpha[level] = level * 256 / (LCD_AA_LEVELS - 1);
+    SurfaceLineAA<uint32_t>(surface, X1, Y1, X2, Y2, blend);
+  }
+  else if (surface.Format() == LTDC_PIXEL_FORMAT_RGB565)
+  {
+    BlendRGB565 blend;
+    blend.color = BSP_LCD_ConvertColor(layer, color);
+    for (level = 0; level < LCD_AA_LEVELS; level++)
+      blend.alpha[level] = level * 32 / (LCD_AA_LEVELS - 1);
+    SurfaceLineAA<uint16_t>(surface, X1, Y1, X2, Y2, blend);
+  }
+  else if (surface.Format() == LTDC_PIXEL_FORMAT_L8 && (count = BSP_LCD_GetPalette(layer, &palette)) != 0)
+  {
+    if (palette != BlendTablePalette || color != BlendTableColor)
+    {
+      /* Nearest palette entry of every background blended at every level */
+      for (i = 0; i < (int)count; i++)
+      {
+        back = palette[i];
+        for (level = 0; level < LCD_AA_LEVELS; level++)
+        {
+          a = level * 255 / (LCD_AA_LEVELS - 1);
+          BlendTableL8[i][level] = BSP_LCD_ConvertColor(layer, 0xFF000000 |
+            (((((color >> 16) & 0xFF) * a + ((back >> 16) & 0xFF) * (255 - a)) / 255) << 16) |
+            (((((color >> 8) & 0xFF) * a + ((back >> 8) & 0xFF) * (255 - a)) / 255) << 8) |
+            (((color & 0xFF) * a + (back & 0xFF) * (255 - a)) / 255));
+        }
+      }
+      BlendTablePalette = palette;
+      BlendTableColor = color;
+    }
+    BlendL8 blend;
+    blend.table = BlendTableL8;
+    SurfaceLineAA<uint8_t>(surface, X1, Y1, X2, Y2, blend);
+  }
+  else
+  {
+    DrawLine(X1, Y1, X2, Y2);
+  }
 }
 
 void LCD_DISCO_F429ZI::DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
@@ -185,12 +789,48 @@ void LCD_DISCO_F429ZI::DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, ui
 
 void LCD_DISCO_F429ZI::DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
 {
-  BSP_LCD_DrawCircle(Xpos, Ypos, Radius);
+  Surface surface = GetSurface();
+  uint32_t value = BSP_LCD_ConvertColor(BSP_LCD_GetActiveLayer(), BSP_LCD_GetTextColor());
+
+  BSP_LCD_WaitForTransfer();
+  switch (surface.PixelSize())
+  {
+  case 4:
+    SurfaceCircle<uint32_t>(surface, Xpos, Ypos, Radius, value);
+    break;
+  case 2:
+    SurfaceCircle<uint16_t>(surface, Xpos, Ypos, Radius, value);
+    break;
+  case 1:
+    SurfaceCircle<uint8_t>(surface, Xpos, Ypos, Radius, value);
+    break;
+  default:
+    BSP_LCD_DrawCircle(Xpos, Ypos, Radius); /* RGB888, unclipped */
+    break;
+  }
 }
 
 void LCD_DISCO_F429ZI::DrawPolygon(pPoint Points, uint16_t PointCount)
 {
-  BSP_LCD_DrawPolygon(Points, PointCount);
+  Surface surface = GetSurface();
+  uint32_t value = BSP_LCD_ConvertColor(BSP_LCD_GetActiveLayer(), BSP_LCD_GetTextColor());
+
+  BSP_LCD_WaitForTransfer();
+  switch (surface.PixelSize())
+  {
+  case 4:
+    SurfacePolygon<uint32_t>(surface, Points, PointCount, value);
+    break;
+  case 2:
+    SurfacePolygon<uint16_t>(surface, Points, PointCount, value);
+    break;
+  case 1:
+    SurfacePolygon<uint8_t>(surface, Points, PointCount, value);
+    break;
+  default:
+    BSP_LCD_DrawPolygon(Points, PointCount); /* RGB888, unclipped */
+    break;
+  }
 }
 
 void LCD_DISCO_F429ZI::DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
@@ -208,6 +848,11 @@ void LCD_DISCO_F429ZI::FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, ui
   BSP_LCD_FillRect(Xpos, Ypos, Width, Height);
 }
 
+uint32_t LCD_DISCO_F429ZI::CopyRect(uint32_t Src, uint32_t SrcPitch, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  return BSP_LCD_CopyRect(Src, SrcPitch, Xpos, Ypos, Width, Height);
+}
+
 void LCD_DISCO_F429ZI::FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
 {
   BSP_LCD_FillCircle(Xpos, Ypos, Radius);
@@ -215,12 +860,49 @@ void LCD_DISCO_F429ZI::FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
 
 void LCD_DISCO_F429ZI::FillTriangle(uint16_t X1, uint16_t X2, uint16_t X3, uint16_t Y1, uint16_t Y2, uint16_t Y3)
 {
-  BSP_LCD_FillTriangle(X1, X2, X3, Y1, Y2, Y3);
+  Point points[3] = {{(int16_t)X1, (int16_t)Y1}, {(int16_t)X2, (int16_t)Y2}, {(int16_t)X3, (int16_t)Y3}};
+
+  FillPolygon(points, 3);
 }
 
 void LCD_DISCO_F429ZI::FillPolygon(pPoint Points, uint16_t PointCount)
 {
-  BSP_LCD_FillPolygon(Points, PointCount);
+  Surface surface = GetSurface();
+  uint32_t value = BSP_LCD_ConvertColor(BSP_LCD_GetActiveLayer(), BSP_LCD_GetTextColor());
+  int xmin, xmax;
+  bool queued;
+
+  if (PointCount < 3 || PointCount > LCD_POLYGON_MAX)
+  {
+    return;
+  }
+
+  xmin = xmax = Points[0].X;
+  for (int i = 1; i < PointCount; i++)
+  {
+    if (Points[i].X < xmin) xmin = Points[i].X;
+    if (Points[i].X > xmax) xmax = Points[i].X;
+  }
+
+  /* Short spans cost less on the CPU than as DMA2D operations; L8 spans would need CPU edges anyway */
+  queued = surface.PixelSize() == 3 || (surface.PixelSize() >= 2 && xmax - xmin >= LCD_SPAN_QUEUE_MIN);
+  if (!queued)
+  {
+    BSP_LCD_WaitForTransfer();
+  }
+
+  switch (surface.PixelSize())
+  {
+  case 2:
+    SurfaceFillPolygon<uint16_t>(surface, Points, PointCount, value, queued);
+    break;
+  case 1:
+    SurfaceFillPolygon<uint8_t>(surface, Points, PointCount, value, queued);
+    break;
+  default:
+    SurfaceFillPolygon<uint32_t>(surface, Points, PointCount, value, queued); /* RGB888 is always queued */
+    break;
+  }
 }
 
 void LCD_DISCO_F429ZI::FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
@@ -240,7 +922,53 @@ void LCD_DISCO_F429ZI::DisplayOff(void)
 
 void LCD_DISCO_F429ZI::DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code)
 {
-  BSP_LCD_DrawPixel(Xpos, Ypos, RGB_Code);
+  Surface surface = GetSurface();
+  uint32_t value = BSP_LCD_ConvertColor(BSP_LCD_GetActiveLayer(), RGB_Code);
+
+  if (!surface.Contains(Xpos, Ypos))
+  {
+    return;
+  }
+
+  BSP_LCD_WaitForTransfer();
+  switch (surface.PixelSize())
+  {
+  case 4:
+    *surface.At<uint32_t>(Xpos, Ypos) = value;
+    break;
+  case 2:
+    *surface.At<uint16_t>(Xpos, Ypos) = value;
+    break;
+  case 1:
+    *surface.At<uint8_t>(Xpos, Ypos) = value;
+    break;
+  default:
+    BSP_LCD_DrawPixel(Xpos, Ypos, RGB_Code);
+    break;
+  }
+}
+
+void LCD_DISCO_F429ZI::SetClipRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  ClipX0 = Xpos;
+  ClipY0 = Ypos;
+  ClipX1 = Xpos + Width;
+  ClipY1 = Ypos + Height;
+}
+
+void LCD_DISCO_F429ZI::ResetClipRect(void)
+{
+  SetClipRect(0, 0, XSize, YSize);
+}
+
+Surface LCD_DISCO_F429ZI::GetSurface(void)
+{
+  uint32_t layer = BSP_LCD_GetActiveLayer();
+  uint32_t format = BSP_LCD_GetPixelFormat(layer);
+  Surface surface((void *)BSP_LCD_GetLayerAddress(layer), XSize, YSize, XSize, format, BSP_LCD_GetPixelSize(format));
+
+  surface.SetClip(ClipX0, ClipY0, ClipX1, ClipY1);
+  return surface;
 }
 
 //=================================================================================================================
@@ -23,6 +23,20 @@
 
 #include <mbed.h>
 #include "stm32f429i_discovery_lcd.h"
+#include "Surface.h"
+
+#define LCD_FRAME_BUFFER_LAYER1                  LCD_FRAME_BUFFER
+#define LCD_LAYER0_FORMAT                        LTDC_PIXEL_FORMAT_L8  /* Pixel format of layer 0, indexed with the LCD_COLOR_ palette */
+#define LCD_LAYER0_BUFFERS                       3    /* Layer-0 frame buffers, allocated in SDRAM */
+#define LCD_CHROME_LAYER                         1    /* Layer composed over layer 0 for static chrome */
+#define LCD_CHROME_KEY                           LCD_COLOR_WHITE  /* Chrome color keyed out to show layer 0 */
+
+#define LCD_POLYGON_MAX                          32   /* Vertices FillPolygon can rasterize */
+#define LCD_SPAN_QUEUE_MIN                       64   /* Polygon width from which the DMA2D fills the spans */
+#define LCD_AA_LEVELS                            16   /* Coverage levels of anti-aliased lines */
+
+#define LCD_LABEL_MAX                            16   /* Labels tracked by DisplayLabelAt */
+#define LCD_LABEL_LENGTH                         32   /* Longest tracked label text */
 
 /*
   This class drives the LCD display (ILI9341 240x320) present on DISCO_F429ZI board.
@@ -84,6 +98,24 @@ public:
     */
   void LayerDefaultInit(uint16_t LayerIndex, uint32_t FB_Address);
 
+  /**
+    * @brief  Initializes an LCD layer with a given pixel format.
+    * @param  LayerIndex: the layer foreground or background. 
+    * @param  FB_Address: the layer frame buffer.
+    * @param  PixelFormat: LTDC pixel format (ARGB8888, RGB888, RGB565, ARGB1555, ARGB4444 or L8)
+    * @retval None
+    */
+  void LayerInit(uint16_t LayerIndex, uint32_t FB_Address, uint32_t PixelFormat);
+
+  /**
+    * @brief  Loads the palette of an L8 layer; colors are drawn as the nearest entry.
+    * @param  LayerIndex: the layer foreground or background. 
+    * @param  pColors: Count ARGB8888 colors, kept by reference
+    * @param  Count: number of colors, 1 to 256
+    * @retval None
+    */
+  void SetPalette(uint32_t LayerIndex, const uint32_t *pColors, uint32_t Count);
+
   /**
     * @brief  Selects the LCD Layer.
     * @param  LayerIndex: the Layer foreground or background.
@@ -128,6 +160,16 @@ public:
     */
   void SetLayerWindow(uint16_t LayerIndex, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 
+  /**
+    * @brief  Sets the line pitch of a layer frame buffer, so the layer can
+    *         show a window of a wider image. Set it after the layer address
+    *         and window, which reset it to the window width.
+    * @param  LayerIndex: layer index
+    * @param  Pitch: pixels from the start of one line to the next
+    * @retval None
+    */
+  void SetLayerPitch(uint32_t LayerIndex, uint32_t Pitch);
+
   /**
     * @brief  Configures and sets the color Keying.
     * @param  LayerIndex: the Layer foreground or background
@@ -208,7 +250,8 @@ public:
   void ClearStringLine(uint32_t Line);
 
   /**
-    * @brief  Displays one character.
+    * @brief  Displays one character, clipped to the clip rectangle. Wholly
+    *         visible characters are copied from the glyph cache by the DMA2D.
     * @param  Xpos: start column address
     * @param  Ypos: the Line where to display the character shape
     * @param  Ascii: character ascii code, must be between 0x20 and 0x7E
@@ -238,6 +281,103 @@ public:
     */
   void DisplayStringAtLine(uint16_t Line, uint8_t *ptr);
 
+  /**
+    * @brief  Displays a string like DisplayStringAt, keeping the drawn text as a
+    *         label identified by its position and mode. When the same label is
+    *         drawn again with the same font and colors, only the character cells
+    *         that differ from the previous text are redrawn; cells left over from
+    *         a longer previous text are cleared with the background color.
+    * @param  X: x position (in pixel)
+    * @param  Y: y position (in pixel)
+    * @param  pText: pointer to string to display on LCD
+    * @param  mode: The display mode (CENTER_MODE, RIGHT_MODE or LEFT_MODE)
+    * @retval None
+    */
+  void DisplayLabelAt(uint16_t X, uint16_t Y, uint8_t *pText, Text_AlignModeTypdef mode);
+
+  /**
+    * @brief  Builds an anti-aliased A8 font in SDRAM from a 1-bpp font,
+    *         downscaled by Scale in each direction.
+    * @param  pSource: 1-bpp source font
+    * @param  Scale: source pixels per output pixel in each direction (1 to 4)
+    * @param  pFont: font to fill in
+    * @retval LCD status
+    */
+  uint8_t CreateFontA8(sFONT *pSource, uint16_t Scale, sFONTA8 *pFont);
+
+  /**
+    * @brief  Displays a string in an A8 font, blended in the text color over
+    *         what is already drawn (no background is painted).
+    * @param  X: x position (in pixel)
+    * @param  Y: y position (in pixel)
+    * @param  pFont: A8 font (see CreateFontA8)
+    * @param  pText: pointer to string to display on LCD
+    * @param  mode: The display mode (CENTER_MODE, RIGHT_MODE or LEFT_MODE)
+    * @retval None
+    */
+  void DisplayStringAtA8(uint16_t X, uint16_t Y, sFONTA8 *pFont, uint8_t *pText, Text_AlignModeTypdef mode);
+
+  /**
+    * @brief  Returns a fence for everything drawn so far. Fills, copies and
+    *         blends are queued to the DMA2D and run in the background.
+    * @retval Fence
+    */
+  uint32_t GetFence(void);
+
+  /**
+    * @brief  Waits until the drawing before a fence is in the frame buffer.
+    * @param  Fence: fence from GetFence
+    * @retval None
+    */
+  void WaitForFence(uint32_t Fence);
+
+  /**
+    * @brief  Switches layer 0 to presented frames with its LCD_LAYER0_BUFFERS
+    *         buffers. From then on drawing is shown only by Present.
+    * @retval LCD status
+    */
+  uint8_t EnableSwapChain(void);
+
+  /**
+    * @brief  Shows everything drawn since the last call at the next vertical
+    *         blanking, without tearing. Drawing continues on a copy of it.
+    * @retval None
+    */
+  void Present(void);
+
+  /**
+    * @brief  Starts drawing static chrome (titles, axes, tick labels) drawn
+    *         once per screen. Hides the chrome layer at the next vertical
+    *         blanking (waiting up to a frame for it), clears it to
+    *         LCD_CHROME_KEY and selects it; its text background is the key,
+    *         so only the drawn strokes cover layer 0. The old chrome is off
+    *         screen until EndChrome's frame is shown.
+    * @retval None
+    */
+  void BeginChrome(void);
+
+  /**
+    * @brief  Selects layer 0 again for the live data and shows the chrome
+    *         with the next presented frame (at once without a swap chain).
+    * @retval None
+    */
+  void EndChrome(void);
+
+  /**
+    * @brief  Hides the chrome with the next presented frame (at once without
+    *         a swap chain).
+    * @retval None
+    */
+  void ClearChrome(void);
+
+  /**
+    * @brief  Forgets all labels so that they are drawn completely next time.
+    *         Called by Clear; needed after drawing over labels by other means.
+    * @param  None
+    * @retval None
+    */
+  void InvalidateLabels(void);
+
   /**
     * @brief  Displays an horizontal line.
     * @param  Xpos: the X position
@@ -257,7 +397,7 @@ public:
   void DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length);
 
   /**
-    * @brief  Displays an uni-line (between two points);.
+    * @brief  Displays an uni-line (between two points), clipped to the clip rectangle.
     * @param  X1: the point 1 X position
     * @param  Y1: the point 1 Y position
     * @param  X2: the point 2 X position
@@ -266,6 +406,20 @@ public:
     */
   void DrawLine(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2);
 
+  /**
+    * @brief  Displays an anti-aliased line (Xiaolin Wu), clipped to the clip
+    *         rectangle. Each step of the major axis blends the text color into
+    *         the two pixels straddling the line, weighted by LCD_AA_LEVELS
+    *         coverage levels. ARGB8888, RGB565 and L8 layers (through a blend
+    *         table of the palette) are supported; other formats get DrawLine.
+    * @param  X1: the point 1 X position
+    * @param  Y1: the point 1 Y position
+    * @param  X2: the point 2 X position
+    * @param  Y2: the point 2 Y position
+    * @retval None
+    */
+  void DrawLineAA(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2);
+
   /**
     * @brief  Displays a rectangle.
     * @param  Xpos: the X position
@@ -277,7 +431,7 @@ public:
   void DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 
   /**
-    * @brief  Displays a circle.
+    * @brief  Displays a circle, clipped to the clip rectangle.
     * @param  Xpos: the X position
     * @param  Ypos: the Y position
     * @param  Radius: the circle radius
@@ -286,7 +440,7 @@ public:
   void DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
 
   /**
-    * @brief  Displays an poly-line (between many points);.
+    * @brief  Displays a closed poly-line (between many points), clipped to the clip rectangle.
     * @param  Points: pointer to the points array
     * @param  PointCount: Number of points
     * @retval None
@@ -322,6 +476,20 @@ public:
     */
   void FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 
+  /**
+    * @brief  Copies a block of pixels in the selected layer's format into
+    *         the layer with the DMA2D. Keep the source unchanged until the
+    *         returned fence is done.
+    * @param  Src: address of the first source pixel
+    * @param  SrcPitch: source pixels from the start of one line to the next
+    * @param  Xpos: the X position
+    * @param  Ypos: the Y position
+    * @param  Width: block width
+    * @param  Height: block height
+    * @retval Fence of the copy
+    */
+  uint32_t CopyRect(uint32_t Src, uint32_t SrcPitch, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+
   /**
     * @brief  Displays a full circle.
     * @param  Xpos: the X position
@@ -332,7 +500,7 @@ public:
   void FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
 
   /**
-    * @brief  Fill triangle.
+    * @brief  Fill triangle, with the scanline rasterizer of FillPolygon.
     * @param  X1: the point 1 x position
     * @param  Y1: the point 1 y position
     * @param  X2: the point 2 x position
@@ -344,9 +512,14 @@ public:
   void FillTriangle(uint16_t X1, uint16_t X2, uint16_t X3, uint16_t Y1, uint16_t Y2, uint16_t Y3);
 
   /**
-    * @brief  Displays a full poly-line (between many points);.
+    * @brief  Displays a full polygon, clipped to the clip rectangle. Each row
+    *         is filled with one span per pair of edge crossings (even-odd
+    *         rule), covering the pixels whose centres lie inside with the
+    *         left and top edges included, so no pixel is written twice and
+    *         shapes sharing an edge do not overlap. Wide polygons are filled
+    *         by the DMA2D, narrow ones and L8 layers by the CPU.
     * @param  Points: pointer to the points array
-    * @param  PointCount: Number of points
+    * @param  PointCount: Number of points, 3 to LCD_POLYGON_MAX
     * @retval None
     */
   void FillPolygon(pPoint Points, uint16_t PointCount);
@@ -376,7 +549,7 @@ public:
   void DisplayOff(void);
 
   /**
-    * @brief  Writes Pixel.
+    * @brief  Writes Pixel, if it is inside the clip rectangle.
     * @param  Xpos: the X position
     * @param  Ypos: the Y position
     * @param  RGB_Code: the pixel color in ARGB mode (8-8-8-8);  
@@ -384,8 +557,54 @@ public:
     */
   void DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code);
 
-private:
+  /**
+    * @brief  Limits DrawLine, DrawCircle, DrawPolygon, DisplayChar and
+    *         DrawPixel to a rectangle of the screen.
+    * @param  Xpos: the X position
+    * @param  Ypos: the Y position
+    * @param  Width: rectangle width
+    * @param  Height: rectangle height
+    * @retval None
+    */
+  void SetClipRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+
+  /**
+    * @brief  Clips to the whole screen again.
+    * @retval None
+    */
+  void ResetClipRect(void);
 
+  /**
+    * @brief  Returns a Surface on the buffer drawn on the active layer (the
+    *         back buffer with a swap chain), clipped to the clip rectangle.
+    *         Call WaitForFence(GetFence()) before writing into it, so queued
+    *         DMA2D work lands first.
+    * @retval Surface
+    */
+  Surface GetSurface(void);
+
+private:
+  typedef struct
+  {
+    uint16_t X;                    /* Position and mode identifying the label */
+    uint16_t Y;
+    Text_AlignModeTypdef Mode;
+    uint16_t Column;               /* First pixel column of the drawn text */
+    sFONT *pFont;                  /* Font and colors the text was drawn with */
+    uint32_t TextColor;
+    uint32_t BackColor;
+    uint8_t Length;                /* Characters on screen */
+    char Text[LCD_LABEL_LENGTH];   /* Text on screen */
+  } LabelTypeDef;
+
+  LabelTypeDef Labels[LCD_LABEL_MAX];
+  uint8_t LabelCount;
+
+  uint32_t Layer0Buffers[LCD_LAYER0_BUFFERS];   /* 0 where SDRAM ran out */
+  bool Presenting;                              /* Layer 0 runs a swap chain */
+
+  uint16_t XSize, YSize;                        /* Screen size, read once */
+  int ClipX0, ClipY0, ClipX1, ClipY1;           /* Clip rectangle, x0 <= x < x1 */
 };
 
 #else
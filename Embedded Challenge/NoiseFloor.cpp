@@ -0,0 +1,19 @@
+#include "NoiseFloor.h" // Include the header file for the adaptive deadband
+
+NoiseFloor::NoiseFloor()
+{
+    Reset();
+}
+
+// Return to the initial noise estimate
+void NoiseFloor::Reset()
+{
+    for (int i = 0; i < 3; i++)
+    {
+        fast_mean[i] = 0;
+        fast_dev[i] = 0;
+        mean[i] = 0;
+        variance[i] = NOISE_INITIAL_STD * NOISE_INITIAL_STD;
+    }
+    still = false;
+}
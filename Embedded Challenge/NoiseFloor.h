@@ -0,0 +1,79 @@
+#ifndef __NOISE_FLOOR_H
+#define __NOISE_FLOOR_H
+
+/* Noise floor constants (rad/s) */
+#define NOISE_FAST_ALPHA   0.1f   // Weight of the newest sample in the short-term statistics
+#define NOISE_SLOW_ALPHA   0.01f  // Weight of the newest still sample in the noise estimate
+#define NOISE_STILL_STD    0.1f   // Short-term deviation below which the sensor is considered still
+#define NOISE_INITIAL_STD  0.02f  // Noise estimate before the first still period
+#define NOISE_DEADBAND_K   4.0f   // Deadband half-width in noise standard deviations
+
+/*
+  Adaptive per-axis deadband driven by an online noise-floor estimate.
+
+  Short-term exponentially weighted mean and variance detect stillness (all
+  axes quieter than NOISE_STILL_STD). Only while still, a slow exponentially
+  weighted mean and variance of each axis track the sensor's bias and noise.
+  Samples within NOISE_DEADBAND_K standard deviations of that bias are set
+  to zero, so an idle sensor integrates no distance; the bias is subtracted
+  from all other samples, so it does not integrate during motion either. Each sample costs a
+  fixed handful of multiply-adds and no square roots.
+*/
+class NoiseFloor
+{
+public:
+    NoiseFloor();
+
+    // Return to the initial noise estimate
+    void Reset();
+
+    // Gate one gyro sample (rad/s) in place and remove the learnt bias.
+    // Returns true when all three axes were inside their deadband.
+    bool Apply(float *gyro_xyz)
+    {
+        float fast_var = 0;
+        for (int i = 0; i < 3; i++)
+        {
+            float d = gyro_xyz[i] - fast_mean[i];
+            fast_mean[i] += NOISE_FAST_ALPHA * d;
+            fast_dev[i] = (1 - NOISE_FAST_ALPHA) * (fast_dev[i] + NOISE_FAST_ALPHA * d * d);
+            if (fast_dev[i] > fast_var)
+                fast_var = fast_dev[i];
+        }
+        still = fast_var < NOISE_STILL_STD * NOISE_STILL_STD;
+
+        int gated = 0;
+        for (int i = 0; i < 3; i++)
+        {
+            float d = gyro_xyz[i] - mean[i];
+            if (still)
+            {
+                mean[i] += NOISE_SLOW_ALPHA * d;
+                variance[i] = (1 - NOISE_SLOW_ALPHA) * (variance[i] + NOISE_SLOW_ALPHA * d * d);
+            }
+            if (d * d < NOISE_DEADBAND_K * NOISE_DEADBAND_K * variance[i])
+            {
+                gyro_xyz[i] = 0;
+                gated++;
+            }
+            else
+            {
+                gyro_xyz[i] = d;
+            }
+        }
+        return gated == 3;
+    }
+
+    // True when the last sample was taken during stillness
+    bool Still() const { return still; }
+
+    // Noise variance of one axis, (rad/s)^2
+    float Variance(int axis) const { return variance[axis]; }
+
+private:
+    float fast_mean[3], fast_dev[3]; // Short-term mean and variance
+    float mean[3], variance[3];      // Bias and noise learnt while still
+    bool still;
+};
+
+#endif
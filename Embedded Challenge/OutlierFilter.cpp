@@ -0,0 +1,43 @@
+#include "OutlierFilter.h" // Include the header file for the Hampel spike filter
+
+OutlierFilter::OutlierFilter(int half_window, float threshold) : threshold(threshold)
+{
+    half = half_window < 1 ? 1 : (half_window > OUTLIER_MAX_HALF ? OUTLIER_MAX_HALF : half_window);
+    Reset();
+}
+
+// Forget the carried-over samples
+void OutlierFilter::Reset()
+{
+    primed = false;
+}
+
+// Filter each axis of the block in place, carrying the window tail between blocks
+void OutlierFilter::Process(float *const axes[3], int n)
+{
+    float extended[2 * OUTLIER_MAX_HALF + OUTLIER_MAX_BLOCK];
+    int tail = 2 * half;
+    if (n > OUTLIER_MAX_BLOCK)
+        n = OUTLIER_MAX_BLOCK;
+    if (n <= 0)
+        return;
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        float *samples = axes[axis];
+
+        // The very first block has no history: repeat its first sample
+        for (int i = 0; i < tail; i++)
+            extended[i] = primed ? history[axis][i] : samples[0];
+        for (int i = 0; i < n; i++)
+            extended[tail + i] = samples[i];
+
+        // Output i is the filtered input centred at extended[i + half]
+        for (int i = 0; i < n; i++)
+            samples[i] = OutlierHampel(extended + i, half, threshold);
+
+        for (int i = 0; i < tail; i++)
+            history[axis][i] = extended[n + i];
+    }
+    primed = true;
+}
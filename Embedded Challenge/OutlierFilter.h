@@ -0,0 +1,84 @@
+#ifndef __OUTLIER_FILTER_H
+#define __OUTLIER_FILTER_H
+
+#include <math.h>
+
+/* Outlier filter constants */
+#define OUTLIER_HALF_WINDOW  2       // Default samples on each side of the tested sample
+#define OUTLIER_MAX_HALF     4       // Largest supported half window
+#define OUTLIER_MAX_BLOCK    32      // Largest block passed to Process()
+#define OUTLIER_THRESHOLD    3.0f    // Default rejection threshold in robust standard deviations
+#define OUTLIER_MAD_SCALE    1.4826f // MAD to standard deviation for Gaussian noise
+#define OUTLIER_MIN_LIMIT    0.5f    // Smallest deviation from the median replaced, rad/s
+
+/*
+  Streaming Hampel filter for the three gyro axes.
+
+  A sample is replaced by the median of the 2 * half + 1 samples centred on it
+  when it lies more than threshold robust standard deviations (1.4826 * MAD)
+  away from that median, and never for deviations below OUTLIER_MIN_LIMIT
+  (a window of mostly deadband zeros has a MAD of 0, which would otherwise
+  flatten the onset of real motion); all other samples pass unchanged, so
+  the filter does not smooth the signal that is later integrated. Blocks are processed in
+  place on structure-of-arrays buffers (one array per axis) and the last
+  2 * half samples of each axis are carried over to the next block, so the
+  output is delayed by half samples. Medians use a min/max sorting network
+  and the replacement is a select, keeping the inner loop free of data
+  dependent branches.
+*/
+class OutlierFilter
+{
+public:
+    OutlierFilter(int half_window = OUTLIER_HALF_WINDOW, float threshold = OUTLIER_THRESHOLD);
+
+    // Forget the carried-over samples
+    void Reset();
+
+    // Filter n (<= OUTLIER_MAX_BLOCK) samples of each axis in place: axes[a][i]
+    void Process(float *const axes[3], int n);
+
+    // Output delay in samples
+    int Delay() const { return half; }
+
+private:
+    int half;                                // Samples on each side of the tested one
+    float threshold;                         // Rejection threshold in robust standard deviations
+    float history[3][2 * OUTLIER_MAX_HALF];  // Last 2 * half input samples per axis
+    bool primed;                             // False until the first block filled the history
+};
+
+// Sort size values in place with an odd-even transposition network of min/max pairs
+static inline void OutlierSort(float *v, int size)
+{
+    for (int pass = 0; pass < size; pass++)
+    {
+        for (int i = pass & 1; i + 1 < size; i += 2)
+        {
+            float lo = fminf(v[i], v[i + 1]);
+            float hi = fmaxf(v[i], v[i + 1]);
+            v[i] = lo;
+            v[i + 1] = hi;
+        }
+    }
+}
+
+// Hampel decision for the centre of window (2 * half + 1 samples)
+static inline float OutlierHampel(const float *window, int half, float threshold)
+{
+    float sorted[2 * OUTLIER_MAX_HALF + 1];
+    int size = 2 * half + 1;
+    for (int i = 0; i < size; i++)
+        sorted[i] = window[i];
+    OutlierSort(sorted, size);
+    float median = sorted[half];
+
+    for (int i = 0; i < size; i++)
+        sorted[i] = fabsf(window[i] - median);
+    OutlierSort(sorted, size);
+    float limit = fmaxf(threshold * OUTLIER_MAD_SCALE * sorted[half], OUTLIER_MIN_LIMIT);
+
+    float centre = window[half];
+    return fabsf(centre - median) > limit ? median : centre;
+}
+
+#endif
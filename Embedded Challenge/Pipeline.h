@@ -0,0 +1,94 @@
+#ifndef __PIPELINE_H
+#define __PIPELINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <tuple>
+#include <type_traits>
+
+/* One sample travelling through a pipeline; stages read and fill the fields they need */
+struct PipelineSample
+{
+    float gyro[3];     // Angular velocity, rad/s
+    float velocity[3]; // Linear velocity
+    float distance;    // Distance covered since the previous sample, m
+    float dt;          // Seconds since the previous sample
+    int index;         // Sample number in the session
+    uint8_t activity;  // ActivityType of the sample
+    bool idle;         // Sample lies entirely inside the noise deadband
+    bool step;         // Sample completes a step
+};
+
+/*
+  Processing chain composed at compile time.
+
+  Each stage is a class with a default constructor, void Reset() and
+  bool Process(PipelineSample &), all visible in a header. The stages are
+  held by value and called in the order of the template arguments, so the
+  compiler sees the whole chain and can inline it into the loop of Run()
+  without any virtual calls. A stage returning false ends the chain for that
+  sample (for example while a filter has not produced output yet). Nothing
+  here depends on Mbed, so the same stages run in host-side replay tools.
+
+  Example (replaying a recorded session):
+      Pipeline<DeadbandStage, HampelStage, StepStage, AxisStatsStage> chain;
+      chain.Get<AxisStatsStage>().Attach(stats.axis);
+      chain.Run(samples, count);
+*/
+template <typename... Stages>
+class Pipeline
+{
+public:
+    // Reset every stage
+    void Reset() { ResetFrom<0>(); }
+
+    // Pass one sample through the chain; false if a stage stopped it
+    bool Process(PipelineSample &sample) { return ProcessFrom<0>(sample); }
+
+    // Pass n samples through the chain; returns how many reached the end
+    int Run(PipelineSample *samples, int n)
+    {
+        int passed = 0;
+        for (int i = 0; i < n; i++)
+        {
+            passed += Process(samples[i]);
+        }
+        return passed;
+    }
+
+    // Access a stage by type, e.g. to configure it or read its results
+    template <typename Stage>
+    Stage &Get() { return std::get<Stage>(stages); }
+
+    template <typename Stage>
+    const Stage &Get() const { return std::get<Stage>(stages); }
+
+private:
+    template <size_t I>
+    typename std::enable_if<(I < sizeof...(Stages)), bool>::type ProcessFrom(PipelineSample &sample)
+    {
+        return std::get<I>(stages).Process(sample) && ProcessFrom<I + 1>(sample);
+    }
+
+    template <size_t I>
+    typename std::enable_if<(I == sizeof...(Stages)), bool>::type ProcessFrom(PipelineSample &)
+    {
+        return true;
+    }
+
+    template <size_t I>
+    typename std::enable_if<(I < sizeof...(Stages))>::type ResetFrom()
+    {
+        std::get<I>(stages).Reset();
+        ResetFrom<I + 1>();
+    }
+
+    template <size_t I>
+    typename std::enable_if<(I == sizeof...(Stages))>::type ResetFrom()
+    {
+    }
+
+    std::tuple<Stages...> stages;
+};
+
+#endif
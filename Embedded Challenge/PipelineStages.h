@@ -0,0 +1,241 @@
+#ifndef __PIPELINE_STAGES_H
+#define __PIPELINE_STAGES_H
+
+#include <math.h>
+#include "Pipeline.h"
+#include "NoiseFloor.h"
+#include "OutlierFilter.h"
+#include "StepDetector.h"
+#include "SessionStats.h"
+
+/* Calibrate: zero samples inside the adaptive noise deadband, remove the learnt bias from the
+   others and flag a sample idle when all three axes were gated */
+class DeadbandStage
+{
+public:
+    // The noise estimate carries over between sessions
+    void Reset() {}
+
+    bool Process(PipelineSample &sample)
+    {
+        sample.idle = floor.Apply(sample.gyro);
+        return true;
+    }
+
+    NoiseFloor floor;
+};
+
+/* Filter: Hampel spike rejection, one sample at a time through the streaming filter. The sample
+   leaves delayed by filter.Delay() samples, its idle flag delayed with it. */
+class HampelStage
+{
+public:
+    HampelStage() { Reset(); }
+
+    void Reset()
+    {
+        filter.Reset();
+        primed = false;
+    }
+
+    bool Process(PipelineSample &sample)
+    {
+        float *axes[3] = {&sample.gyro[0], &sample.gyro[1], &sample.gyro[2]};
+        filter.Process(axes, 1);
+
+        // Like the filter, repeat the first sample into the history
+        if (!primed)
+            idle_history = sample.idle ? ~0u : 0;
+        primed = true;
+        idle_history = (idle_history << 1) | (sample.idle ? 1 : 0);
+        sample.idle = (idle_history >> filter.Delay()) & 1;
+        return true;
+    }
+
+    OutlierFilter filter;
+
+private:
+    uint32_t idle_history; // Idle flags of the latest samples, newest in bit 0
+    bool primed;
+};
+
+/* Detect: flag samples that complete a step. Gated samples are fed too, so the detector's
+   timing runs through pauses. */
+class StepStage
+{
+public:
+    void Reset() { detector.Reset(); }
+
+    bool Process(PipelineSample &sample)
+    {
+        sample.step = detector.Update(sample.gyro, sample.dt);
+        return true;
+    }
+
+    StepDetector detector;
+};
+
+/* Integrate: linear velocity from the change of angular velocity times the radius of each axis.
+   Idle samples carry gated zeros, so the difference restarts at them and at the sample after them
+   instead of turning every start and stop of a movement into a full-step velocity spike. */
+class VelocityStage
+{
+public:
+    VelocityStage() { SetRadius(1, 1, 1); Reset(); }
+
+    void SetRadius(float x, float y, float z)
+    {
+        radius[0] = x;
+        radius[1] = y;
+        radius[2] = z;
+    }
+
+    void Reset()
+    {
+        first = true;
+        was_idle = false;
+    }
+
+    bool Process(PipelineSample &sample)
+    {
+        // The first sample of a session or after an idle one has no predecessor and zero velocity
+        bool restart = first || sample.idle || was_idle;
+        for (int i = 0; i < 3; i++)
+        {
+            sample.velocity[i] = restart ? 0 : (previous[i] - sample.gyro[i]) * radius[i];
+            previous[i] = sample.gyro[i];
+        }
+        first = false;
+        was_idle = sample.idle;
+        return true;
+    }
+
+private:
+    float radius[3];
+    float previous[3];
+    bool first;
+    bool was_idle; // The previous sample was idle
+};
+
+/* Integrate: distance of the sample from the swing velocity, converted with the model of its activity */
+class DistanceStage
+{
+public:
+    DistanceStage() : scale(0), models(0), offset(0) { Reset(); }
+
+    // scale[activity]: raw distance per metre, 0 for activities that cover no distance
+    void SetModels(const float *activity_scale, int count)
+    {
+        scale = activity_scale;
+        models = count;
+    }
+
+    // Calibration offset in metres subtracted from the total by Distance()
+    void SetOffset(float metres) { offset = metres; }
+
+    void Reset() { total = 0; }
+
+    bool Process(PipelineSample &sample)
+    {
+        float raw = fabsf(sample.velocity[0] * sample.dt);
+        float s = sample.activity < models ? scale[sample.activity] : 0;
+        sample.distance = s > 0 ? raw / s : 0;
+        total += sample.distance;
+        return true;
+    }
+
+    // Distance accumulated since the last Reset(), m
+    double Total() const { return total; }
+
+    // Calibrated distance: the total less the offset, never negative
+    double Distance() const { return total > offset ? total - offset : 0; }
+
+private:
+    const float *scale;
+    int models;
+    float offset;
+    double total;
+};
+
+/* Accumulate: store each sample's values in session arrays indexed by PipelineSample::index */
+class RecordStage
+{
+public:
+    RecordStage() : gyro(0), velocity(0), distance(0), activity(0), capacity(0) {}
+
+    void Attach(float (*gyro_out)[3], float (*velocity_out)[3], float *distance_out, uint8_t *activity_out, int length)
+    {
+        gyro = gyro_out;
+        velocity = velocity_out;
+        distance = distance_out;
+        activity = activity_out;
+        capacity = length;
+    }
+
+    void Reset() {}
+
+    bool Process(PipelineSample &sample)
+    {
+        int i = sample.index;
+        if (i < 0 || i >= capacity)
+            return true;
+        for (int axis = 0; axis < 3; axis++)
+        {
+            gyro[i][axis] = sample.gyro[axis];
+            velocity[i][axis] = sample.velocity[axis];
+        }
+        distance[i] = sample.distance;
+        activity[i] = sample.activity;
+        return true;
+    }
+
+private:
+    float (*gyro)[3];
+    float (*velocity)[3];
+    float *distance;
+    uint8_t *activity;
+    int capacity;
+};
+
+/* Accumulate: per-axis statistics of the angular velocity */
+class AxisStatsStage
+{
+public:
+    AxisStatsStage() : stats(0) {}
+
+    void Attach(RunningStats *axis_stats) { stats = axis_stats; }
+
+    void Reset() {}
+
+    bool Process(PipelineSample &sample)
+    {
+        for (int i = 0; i < 3; i++)
+            stats[i].Add(sample.gyro[i]);
+        return true;
+    }
+
+private:
+    RunningStats *stats; // Three entries, owned by the caller
+};
+
+/* Accumulate: statistics of the speed derived from the sample distance */
+class SpeedStatsStage
+{
+public:
+    SpeedStatsStage() : stats(0) {}
+
+    void Attach(RunningStats *speed_stats) { stats = speed_stats; }
+
+    void Reset() {}
+
+    bool Process(PipelineSample &sample)
+    {
+        stats->Add(sample.dt > 0 ? sample.distance / sample.dt : 0);
+        return true;
+    }
+
+private:
+    RunningStats *stats; // Owned by the caller
+};
+
+#endif
@@ -0,0 +1,81 @@
+#include "ScrollLayer.h" // Include the header file for the hardware-scrolled canvas
+
+ScrollLayer::ScrollLayer(uint16_t width, uint16_t height)
+    : view_w(0), view_h(0), pan_x(0), pan_y(0), visible(false)
+{
+    uint32_t format = BSP_LCD_GetPixelFormat(SCROLL_LAYER);
+    int size = BSP_LCD_GetPixelSize(format);
+    buffer = BSP_SDRAM_Alloc(width * height * size);
+    canvas = Surface((void *)buffer, width, height, width, format, size);
+}
+
+// Show the canvas in a screen area, at the current pan position
+void ScrollLayer::Show(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+    if (!Valid())
+        return; // Out of SDRAM: the layer would point at address 0
+
+    view_w = width;
+    view_h = height;
+    BSP_LCD_SetLayerWindow_NoReload(SCROLL_LAYER, x, y, width, height);
+    BSP_LCD_ResetColorKeying_NoReload(SCROLL_LAYER);
+    visible = true;
+    Clamp(pan_x, pan_y);
+    SetAddress();
+    BSP_LCD_SetLayerVisible_NoReload(SCROLL_LAYER, ENABLE);
+    Latch();
+}
+
+// Point the layer at canvas position (x, y); takes effect at the next vertical blanking
+void ScrollLayer::Pan(int x, int y)
+{
+    if (!Valid())
+        return;
+
+    Clamp(x, y);
+    if (visible)
+    {
+        SetAddress();
+        BSP_LCD_Relaod(LCD_RELOAD_VERTICAL_BLANKING); // Scrolls between presented frames too
+    }
+}
+
+// Disable the layer and restore the configuration set by LCD_DISCO_F429ZI
+void ScrollLayer::Hide()
+{
+    BSP_LCD_SetLayerVisible_NoReload(SCROLL_LAYER, DISABLE);
+    BSP_LCD_SetLayerWindow_NoReload(SCROLL_LAYER, 0, 0, BSP_LCD_GetXSize(), BSP_LCD_GetYSize());
+    BSP_LCD_SetLayerAddress_NoReload(SCROLL_LAYER, LCD_FRAME_BUFFER_LAYER1); // Also restores the full-width pitch
+    BSP_LCD_SetColorKeying_NoReload(SCROLL_LAYER, LCD_CHROME_KEY);
+    visible = false;
+    Latch();
+}
+
+// Store the pan position, clamped so the window stays inside the canvas
+void ScrollLayer::Clamp(int x, int y)
+{
+    int max_x = canvas.Width() - view_w;
+    int max_y = canvas.Height() - view_h;
+    pan_x = x < 0 ? 0 : (x > max_x ? max_x : x);
+    pan_y = y < 0 ? 0 : (y > max_y ? max_y : y);
+}
+
+// Write the pan position to the shadow registers
+void ScrollLayer::SetAddress()
+{
+    // The address resets the pitch to the window width, so the pitch goes second
+    BSP_LCD_SetLayerAddress_NoReload(SCROLL_LAYER, Address(pan_x, pan_y));
+    BSP_LCD_SetLayerPitch_NoReload(SCROLL_LAYER, canvas.Pitch());
+}
+
+// Show or hide the layer with the layer 0 frame it belongs to: the swap chain
+// latches the shadow registers with the next presented frame. Without one they
+// are latched at the next vertical blanking; an immediate reload could latch
+// a layer 0 address mid-scan.
+void ScrollLayer::Latch()
+{
+    if (!BSP_LCD_IsPresenting())
+    {
+        BSP_LCD_Relaod(LCD_RELOAD_VERTICAL_BLANKING);
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef __SCROLL_LAYER_H
+#define __SCROLL_LAYER_H
+
+#include <mbed.h>
+#include "LCD_DISCO_F429ZI.h"
+
+/* Scroll layer constants */
+#define SCROLL_LAYER LCD_CHROME_LAYER // LTDC layer showing the canvas (views using it have no chrome)
+
+/*
+  Virtual canvas larger than its screen window, scrolled by the LTDC.
+
+  The canvas lives in SDRAM in the pixel format of SCROLL_LAYER. Show()
+  shrinks the layer window to a screen area and Pan() points the layer at
+  the canvas pixel shown in the window's top-left corner, with the line
+  pitch set to the canvas width. Scrolling in either direction therefore
+  costs a few register writes latched at the next vertical blanking and no
+  pixel copies. Content is drawn into the canvas through GetSurface(), only
+  when Valid(): if the SDRAM allocation fails Show() and Pan() do nothing.
+
+  Example (a log of text lines scrolling up):
+      ScrollLayer log(240, 1024);
+      log.Show(0, 30, 240, 290);
+      ... draw line n at canvas row n * 20 ...
+      log.Pan(0, n * 20 + 20 - 290); // Bottom line at the bottom of the window
+*/
+class ScrollLayer
+{
+public:
+    // width, height: canvas size in pixels
+    ScrollLayer(uint16_t width, uint16_t height);
+
+    // Whether the canvas was allocated
+    bool Valid() const { return buffer != 0; }
+
+    // Drawing view of the whole canvas
+    Surface GetSurface() const { return canvas; }
+
+    // Show the canvas in a screen area, at the current pan position, with the
+    // next presented frame (at the next vertical blanking without a swap chain)
+    void Show(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+    // Move the window to canvas position (x, y), clamped to the canvas
+    void Pan(int x, int y);
+
+    // Disable the layer and restore its default configuration, with the next
+    // presented frame
+    void Hide();
+
+    int PanX() const { return pan_x; }
+    int PanY() const { return pan_y; }
+    bool Visible() const { return visible; }
+
+private:
+    void Clamp(int x, int y);
+    void SetAddress();
+    void Latch();
+    uint32_t Address(int x, int y) const { return buffer + (y * canvas.Pitch() + x) * canvas.PixelSize(); }
+
+    uint32_t buffer;   // SDRAM canvas, 0 if not allocated
+    Surface canvas;    // The same canvas for drawing
+    uint16_t view_w, view_h; // Window size while shown
+    int pan_x, pan_y;  // Canvas pixel in the window's top-left corner
+    bool visible;
+};
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef __SESSION_STATS_H
+#define __SESSION_STATS_H
+
+#include <stdint.h>
+#include <math.h>
+
+/*
+  Online statistics of one signal: count, extremes, mean and variance.
+
+  Mean and variance use Welford's update, which accumulates the squared
+  deviations from the running mean instead of a raw sum of squares and so
+  stays accurate however long the session runs. Every update is O(1) and
+  nothing is stored per sample.
+*/
+class RunningStats
+{
+public:
+    RunningStats() { Reset(); }
+
+    // Forget all samples
+    void Reset()
+    {
+        count = 0;
+        mean = 0;
+        m2 = 0;
+        min = 0;
+        max = 0;
+    }
+
+    // Add one sample
+    void Add(float x)
+    {
+        count++;
+        float delta = x - mean;
+        mean += delta / count;
+        m2 += delta * (x - mean);
+        if (count == 1 || x < min)
+            min = x;
+        if (count == 1 || x > max)
+            max = x;
+    }
+
+    uint32_t Count() const { return count; }
+    float Mean() const { return mean; }
+    float Min() const { return min; }
+    float Max() const { return max; }
+
+    // Sample variance (0 with fewer than two samples)
+    float Variance() const { return count > 1 ? m2 / (count - 1) : 0; }
+
+    float StdDev() const { return sqrtf(Variance()); }
+
+private:
+    uint32_t count;
+    float mean; // Running mean
+    float m2;   // Sum of squared deviations from the running mean
+    float min, max;
+};
+
+/* Statistics of a measurement session: the three gyro axes (rad/s) and speed (m/s) */
+struct SessionStats
+{
+    RunningStats axis[3];
+    RunningStats speed;
+
+    void Reset()
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            axis[i].Reset();
+        }
+        speed.Reset();
+    }
+};
+
+#endif
@@ -0,0 +1,238 @@
+#include "Spectrum.h" // Include the header file for the sliding-window FFT
+#include <math.h>
+
+#ifdef ARM_MATH_CM4
+#include "arm_math.h" // CMSIS-DSP real FFT on the target
+#endif
+
+#define PI_F 3.14159265358979f
+#define HALF_SIZE (SPECTRUM_SIZE / 2)
+
+/* Tables shared by all instances, filled on first construction */
+static float window_table[SPECTRUM_SIZE]; // Hann window
+static bool tables_ready = false;
+
+#ifdef ARM_MATH_CM4
+static arm_rfft_fast_instance_f32 rfft;
+#else
+static float twiddle_cos[HALF_SIZE]; // cos(2*pi*k/SPECTRUM_SIZE)
+static float twiddle_sin[HALF_SIZE]; // sin(2*pi*k/SPECTRUM_SIZE)
+static uint16_t bit_reverse[HALF_SIZE];
+
+// Portable real FFT producing the same packed layout as arm_rfft_fast_f32:
+// out[0] = X[0], out[1] = X[N/2], out[2k] + j*out[2k+1] = X[k] for 0 < k < N/2.
+// The N real inputs are treated as N/2 complex values, transformed with an
+// iterative radix-2 FFT and split into the spectrum of the real sequence.
+static void RealFFT(const float *in, float *out)
+{
+    float re[HALF_SIZE], im[HALF_SIZE];
+
+    // Pack even samples as real and odd samples as imaginary parts, bit-reversed
+    for (int n = 0; n < HALF_SIZE; n++)
+    {
+        re[bit_reverse[n]] = in[2 * n];
+        im[bit_reverse[n]] = in[2 * n + 1];
+    }
+
+    // Radix-2 butterflies; the N/2-point twiddle for index k is the N-point one at 2k
+    for (int len = 2; len <= HALF_SIZE; len <<= 1)
+    {
+        int step = SPECTRUM_SIZE / len;
+        for (int start = 0; start < HALF_SIZE; start += len)
+        {
+            for (int k = 0; k < len / 2; k++)
+            {
+                float wr = twiddle_cos[k * step];
+                float wi = -twiddle_sin[k * step];
+                int a = start + k;
+                int b = a + len / 2;
+                float tr = re[b] * wr - im[b] * wi;
+                float ti = re[b] * wi + im[b] * wr;
+                re[b] = re[a] - tr;
+                im[b] = im[a] - ti;
+                re[a] += tr;
+                im[a] += ti;
+            }
+        }
+    }
+
+    // Split the packed transform into the spectrum of the real input
+    out[0] = re[0] + im[0];
+    out[1] = re[0] - im[0];
+    for (int k = 1; k < HALF_SIZE; k++)
+    {
+        float zr = re[k], zi = im[k];
+        float cr = re[HALF_SIZE - k], ci = -im[HALF_SIZE - k]; // conj(Z[N/2 - k])
+
+        float er = 0.5f * (zr + cr), ei = 0.5f * (zi + ci); // Even part
+        float or_ = 0.5f * (zi - ci), oi = -0.5f * (zr - cr); // Odd part
+        float wr = twiddle_cos[k], wi = -twiddle_sin[k];
+
+        out[2 * k] = er + or_ * wr - oi * wi;
+        out[2 * k + 1] = ei + or_ * wi + oi * wr;
+    }
+}
+#endif
+
+// Fill the window (and FFT) tables once
+static void InitTables()
+{
+    if (tables_ready)
+        return;
+
+    for (int i = 0; i < SPECTRUM_SIZE; i++)
+    {
+        window_table[i] = 0.5f - 0.5f * cosf(2 * PI_F * i / (SPECTRUM_SIZE - 1));
+    }
+
+#ifdef ARM_MATH_CM4
+    arm_rfft_fast_init_f32(&rfft, SPECTRUM_SIZE);
+#else
+    int bits = 0;
+    while ((1 << bits) < HALF_SIZE)
+        bits++;
+    for (int i = 0; i < HALF_SIZE; i++)
+    {
+        twiddle_cos[i] = cosf(2 * PI_F * i / SPECTRUM_SIZE);
+        twiddle_sin[i] = sinf(2 * PI_F * i / SPECTRUM_SIZE);
+
+        int r = 0;
+        for (int b = 0; b < bits; b++)
+            r |= ((i >> b) & 1) << (bits - 1 - b);
+        bit_reverse[i] = r;
+    }
+#endif
+    tables_ready = true;
+}
+
+Spectrum::Spectrum(float sample_rate) : sample_rate(sample_rate)
+{
+    InitTables();
+    Reset();
+}
+
+// Drop all buffered samples and results
+void Spectrum::Reset()
+{
+    head = 0;
+    filled = 0;
+    since_frame = 0;
+    frame_start = 0;
+    pending_axis = -1;
+    cadence = 0;
+    energy = 0;
+    frames = 0;
+    for (int k = 0; k < SPECTRUM_BINS; k++)
+    {
+        power[k] = 0;
+    }
+}
+
+// Append one sample and start a new frame every SPECTRUM_HOP samples
+void Spectrum::Push(const float *gyro_xyz)
+{
+    for (int axis = 0; axis < 3; axis++)
+    {
+        history[axis][head] = gyro_xyz[axis];
+    }
+    head = (head + 1) % SPECTRUM_HISTORY;
+    if (filled < SPECTRUM_SIZE)
+        filled++;
+
+    if (++since_frame >= SPECTRUM_HOP && filled == SPECTRUM_SIZE)
+    {
+        // The newest SPECTRUM_SIZE samples form the frame; the extra SPECTRUM_HOP
+        // slots in the ring keep them intact until the next frame starts
+        since_frame = 0;
+        frame_start = (head + SPECTRUM_HISTORY - SPECTRUM_SIZE) % SPECTRUM_HISTORY;
+        pending_axis = 0;
+    }
+}
+
+// Transform the next pending axis, finishing the frame after the last one
+bool Spectrum::Process()
+{
+    if (pending_axis < 0)
+        return false;
+
+    Transform(pending_axis);
+    if (++pending_axis < 3)
+        return false;
+
+    pending_axis = -1;
+    Analyse();
+    return true;
+}
+
+// Window one axis of the current frame, transform it and accumulate its power
+void Spectrum::Transform(int axis)
+{
+    const float *samples = history[axis];
+
+    // Remove the mean so the gyro bias does not leak into the low bins
+    float mean = 0;
+    for (int i = 0, j = frame_start; i < SPECTRUM_SIZE; i++, j = (j + 1) % SPECTRUM_HISTORY)
+    {
+        mean += samples[j];
+    }
+    mean /= SPECTRUM_SIZE;
+
+    for (int i = 0, j = frame_start; i < SPECTRUM_SIZE; i++, j = (j + 1) % SPECTRUM_HISTORY)
+    {
+        frame[i] = (samples[j] - mean) * window_table[i];
+    }
+
+#ifdef ARM_MATH_CM4
+    arm_rfft_fast_f32(&rfft, frame, bins, 0);
+#else
+    RealFFT(frame, bins);
+#endif
+
+    if (axis == 0)
+    {
+        accum[0] = bins[0] * bins[0];
+    }
+    else
+    {
+        accum[0] += bins[0] * bins[0];
+    }
+    for (int k = 1; k < SPECTRUM_BINS; k++)
+    {
+        float p = bins[2 * k] * bins[2 * k] + bins[2 * k + 1] * bins[2 * k + 1];
+        accum[k] = axis == 0 ? p : accum[k] + p;
+    }
+}
+
+// Publish the summed spectrum and extract cadence and band energy
+void Spectrum::Analyse()
+{
+    float bin_width = BinWidth();
+    int first = (int)ceilf(SPECTRUM_MIN_HZ / bin_width);
+    int last = (int)(SPECTRUM_MAX_HZ / bin_width);
+    if (first < 1)
+        first = 1;
+    if (last > SPECTRUM_BINS - 2)
+        last = SPECTRUM_BINS - 2;
+
+    int peak = first;
+    energy = 0;
+    for (int k = 0; k < SPECTRUM_BINS; k++)
+    {
+        power[k] = accum[k];
+        if (k >= first && k <= last)
+        {
+            energy += accum[k];
+            if (accum[k] > accum[peak])
+                peak = k;
+        }
+    }
+    energy /= SPECTRUM_SIZE;
+
+    // Parabolic interpolation between the neighbouring bins refines the peak
+    float left = accum[peak - 1], centre = accum[peak], right = accum[peak + 1];
+    float denom = left - 2 * centre + right;
+    float offset = denom < 0 ? 0.5f * (left - right) / denom : 0;
+    cadence = (peak + offset) * bin_width;
+
+    frames++;
+}
@@ -0,0 +1,79 @@
+#ifndef __SPECTRUM_H
+#define __SPECTRUM_H
+
+#include <stdint.h>
+
+/* Sliding-window FFT constants */
+#define SPECTRUM_SIZE     128   // Samples per FFT window (power of two)
+#define SPECTRUM_BINS     (SPECTRUM_SIZE / 2)
+#define SPECTRUM_HOP      16    // New samples between two analysis frames
+#define SPECTRUM_HISTORY  (SPECTRUM_SIZE + SPECTRUM_HOP) // Ring length, keeps a frame intact while it is processed
+#define SPECTRUM_MIN_HZ   0.5f  // Lowest frequency searched for the cadence
+#define SPECTRUM_MAX_HZ   4.0f  // Highest frequency searched for the cadence
+
+/*
+  Sliding-window frequency analysis of the three gyro axes.
+
+  Samples are kept in a ring of SPECTRUM_HISTORY per axis. Every SPECTRUM_HOP
+  samples a new frame is started: each axis is mean-removed, multiplied by a
+  precomputed Hann window and passed through a real FFT (CMSIS-DSP
+  arm_rfft_fast_f32 when ARM_MATH_CM4 is defined, a portable packed
+  radix-2 FFT otherwise). Process() transforms at most one axis per call so
+  the work of a frame is spread over several sample periods. When the last
+  axis is done, the summed power spectrum gives the dominant cadence and the
+  spectral energy in the cadence band.
+*/
+class Spectrum
+{
+public:
+    // sample_rate: rate at which Push() is called, in Hz
+    Spectrum(float sample_rate);
+
+    // Drop all buffered samples and results
+    void Reset();
+
+    // Append one gyro sample (rad/s)
+    void Push(const float *gyro_xyz);
+
+    // Run the pending work for at most one axis.
+    // Returns true when this call completed a new frame.
+    bool Process();
+
+    // Dominant frequency in the cadence band, in Hz (0 until the first frame)
+    float Cadence() const { return cadence; }
+
+    // Windowed signal energy of all axes within the cadence band
+    float Energy() const { return energy; }
+
+    // Power of the latest frame per frequency bin, summed over the axes
+    const float *Power() const { return power; }
+
+    // Frequency in Hz of one bin of Power()
+    float BinWidth() const { return sample_rate / SPECTRUM_SIZE; }
+
+    // Number of frames completed since the last Reset()
+    uint32_t Frames() const { return frames; }
+
+private:
+    void Transform(int axis);
+    void Analyse();
+
+    float sample_rate;
+    float history[3][SPECTRUM_HISTORY]; // Ring buffer of the latest samples per axis
+    int head;                           // Next write position in history
+    int filled;                         // Valid samples in history (up to SPECTRUM_SIZE)
+    int since_frame;                    // Samples pushed since the last frame started
+    int frame_start;                    // History index of the oldest sample of the current frame
+    int pending_axis;                   // Next axis to transform, -1 when idle
+
+    float frame[SPECTRUM_SIZE];      // Windowed input frame
+    float bins[SPECTRUM_SIZE];       // Packed FFT output (DC, Nyquist, then re/im pairs)
+    float accum[SPECTRUM_BINS];      // Power summed over the axes transformed so far
+    float power[SPECTRUM_BINS];      // Power of the last completed frame
+
+    float cadence;
+    float energy;
+    uint32_t frames;
+};
+
+#endif
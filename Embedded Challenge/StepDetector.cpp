@@ -0,0 +1,38 @@
+#include "StepDetector.h" // Include the header file for the step detector
+
+StepDetector::StepDetector()
+{
+    Reset();
+}
+
+// Clear the step count and detector state
+void StepDetector::Reset()
+{
+    swing = 0;
+    since_step = STEP_MIN_INTERVAL; // Allow a step right away
+    armed = true;
+    count = 0;
+}
+
+// Process one gyro sample and report whether a step was completed
+bool StepDetector::Update(const float *gyro_xyz, float dt)
+{
+    float rate = gyro_xyz[0] < 0 ? -gyro_xyz[0] : gyro_xyz[0]; // Swing rate on the X axis
+
+    // Exponential smoothing to suppress single-sample noise
+    swing += STEP_SMOOTHING * (rate - swing);
+    since_step += dt;
+
+    if (swing < STEP_RELEASE_THRESH)
+    {
+        armed = true; // Swing finished, wait for the next one
+    }
+    else if (armed && swing > STEP_ARM_THRESH && since_step >= STEP_MIN_INTERVAL)
+    {
+        armed = false;
+        since_step = 0;
+        count++;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,41 @@
+#ifndef __STEPDETECTOR_H
+#define __STEPDETECTOR_H
+
+#include <stdint.h>
+
+/* Step detection constants (leg swing on the gyro X axis, rad/s) */
+#define STEP_ARM_THRESH     1.5f  // Swing rate that marks a step
+#define STEP_RELEASE_THRESH 0.5f  // Swing rate that re-arms the detector
+#define STEP_MIN_INTERVAL   0.4f  // Shortest time between two steps in seconds
+#define STEP_SMOOTHING      0.3f  // Weight of the newest sample in the smoothed swing rate
+
+/*
+  Detects steps from the leg swing seen by the gyroscope.
+
+  One step is reported each time the smoothed swing rate rises above
+  STEP_ARM_THRESH, provided it dropped below STEP_RELEASE_THRESH since the
+  previous step and at least STEP_MIN_INTERVAL seconds have passed.
+*/
+class StepDetector
+{
+public:
+    StepDetector();
+
+    // Clear the step count and detector state
+    void Reset();
+
+    // Feed one gyro sample (rad/s) taken dt seconds after the previous one.
+    // Returns true when this sample completes a new step.
+    bool Update(const float *gyro_xyz, float dt);
+
+    // Number of steps detected since the last Reset()
+    int Count() const { return count; }
+
+private:
+    float swing;      // Smoothed absolute swing rate
+    float since_step; // Seconds since the last detected step
+    bool armed;       // True once the swing rate dropped below the release threshold
+    int count;        // Steps detected so far
+};
+
+#endif
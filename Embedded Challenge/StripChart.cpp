@@ -0,0 +1,124 @@
+#include "StripChart.h" // Include the header file for the scrolling chart
+
+/* Trace colours, all in the layer 0 palette */
+static const uint32_t series_colors[STRIP_SERIES] = {LCD_COLOR_RED, LCD_COLOR_GREEN, LCD_COLOR_BLUE};
+
+// Render one column into both copies: background, zero line, then a vertical
+// segment per series joining its previous row to the new one (none when negative)
+template <typename P>
+static void RenderColumn(const Surface &canvas, int column, int copy, uint32_t background, uint32_t grid, int zero,
+                         const uint32_t *colors, const int *from, const int *to)
+{
+    int pitch = canvas.Pitch();
+    P *a = canvas.At<P>(column, 0);
+    P *b = canvas.At<P>(copy, 0);
+
+    for (int offset = 0; offset < canvas.Height() * pitch; offset += pitch)
+    {
+        a[offset] = (P)background;
+        b[offset] = (P)background;
+    }
+    a[zero * pitch] = (P)grid;
+    b[zero * pitch] = (P)grid;
+
+    for (int s = 0; s < STRIP_SERIES; s++)
+    {
+        if (to[s] < 0)
+            continue;
+        int top = from[s] < to[s] ? from[s] : to[s];
+        int bottom = from[s] < to[s] ? to[s] : from[s];
+        for (int offset = top * pitch; offset <= bottom * pitch; offset += pitch)
+        {
+            a[offset] = (P)colors[s];
+            b[offset] = (P)colors[s];
+        }
+    }
+}
+
+StripChart::StripChart(uint16_t x, uint16_t y, uint16_t width, uint16_t height, float min, float max)
+    : fence(0), x(x), y(y), width(width), height(height), min(min), max(max)
+{
+    uint32_t format = BSP_LCD_GetPixelFormat(0);
+    int size = BSP_LCD_GetPixelSize(format);
+    buffer = BSP_SDRAM_Alloc(2 * width * height * size); // Two copies of every column
+    canvas = Surface((void *)buffer, 2 * width, height, 2 * width, format, size);
+
+    background = BSP_LCD_ConvertColor(0, STRIP_BACKGROUND);
+    grid = BSP_LCD_ConvertColor(0, STRIP_GRID);
+    for (int s = 0; s < STRIP_SERIES; s++)
+    {
+        colors[s] = BSP_LCD_ConvertColor(0, series_colors[s]);
+    }
+    Reset();
+}
+
+// Chart row of a value (0 at the top), clamped to the chart
+int StripChart::Row(float value) const
+{
+    int row = (int)((max - value) / (max - min) * (height - 1) + 0.5f);
+    return row < 0 ? 0 : (row >= height ? height - 1 : row);
+}
+
+// Clear the history to empty columns
+void StripChart::Reset()
+{
+    int empty[STRIP_SERIES];
+    for (int s = 0; s < STRIP_SERIES; s++)
+    {
+        empty[s] = -1;
+        last[s] = -1;
+    }
+
+    BSP_LCD_WaitForFence(fence); // A queued copy may still read the canvas
+    for (head = 0; head < width; head++)
+    {
+        RenderHead(empty, empty);
+    }
+    head = width - 1;
+}
+
+// Render the new column at the head of the ring
+void StripChart::Add(const float *values)
+{
+    int to[STRIP_SERIES], from[STRIP_SERIES];
+    for (int s = 0; s < STRIP_SERIES; s++)
+    {
+        to[s] = Row(values[s]);
+        from[s] = last[s] < 0 ? to[s] : last[s]; // The first sample is a single dot
+        last[s] = to[s];
+    }
+
+    head = (head + 1) % width;
+    BSP_LCD_WaitForFence(fence); // The previous copy reads both copies of the column
+    RenderHead(from, to);
+}
+
+// Write the head column and its copy in the canvas pixel type
+void StripChart::RenderHead(const int *from, const int *to)
+{
+    if (!buffer)
+        return; // Out of SDRAM: the chart stays blank
+
+    switch (canvas.PixelSize())
+    {
+    case 4:
+        RenderColumn<uint32_t>(canvas, head, head + width, background, grid, Row(0), colors, from, to);
+        break;
+    case 2:
+        RenderColumn<uint16_t>(canvas, head, head + width, background, grid, Row(0), colors, from, to);
+        break;
+    case 1:
+        RenderColumn<uint8_t>(canvas, head, head + width, background, grid, Row(0), colors, from, to);
+        break;
+    }
+}
+
+// Copy the width columns ending at the head into the layer 0 back buffer
+void StripChart::Draw(LCD_DISCO_F429ZI &lcd)
+{
+    if (!buffer)
+        return;
+
+    lcd.SelectLayer(0);
+    fence = lcd.CopyRect(buffer + (head + 1) * canvas.PixelSize(), canvas.Pitch(), x, y, width, height);
+}
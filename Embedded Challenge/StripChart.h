@@ -0,0 +1,55 @@
+#ifndef __STRIP_CHART_H
+#define __STRIP_CHART_H
+
+#include <mbed.h>
+#include "LCD_DISCO_F429ZI.h"
+
+/* Strip chart constants */
+#define STRIP_SERIES     3                  // Values per sample, one trace each
+#define STRIP_BACKGROUND LCD_COLOR_WHITE    // Empty chart area
+#define STRIP_GRID       LCD_COLOR_LIGHTGRAY // Zero line
+
+/*
+  Scrolling chart of the live samples, one pixel column per sample, on layer 0.
+
+  The history lives in SDRAM in the layer 0 pixel format as a ring of
+  2 x width columns where column i and column i + width always hold the same
+  data, so any width consecutive columns form a contiguous picture. Add()
+  renders only the new column (into both copies) and Draw() puts the window
+  ending at the newest column on screen with one DMA2D block copy, so the
+  cost of a sample does not depend on how much history is shown. The newest
+  sample is at the right edge. If the SDRAM allocation fails nothing is
+  rendered or drawn.
+*/
+class StripChart
+{
+public:
+    // x, y, width, height: screen area; min, max: value range across the height
+    StripChart(uint16_t x, uint16_t y, uint16_t width, uint16_t height, float min, float max);
+
+    // Clear the history
+    void Reset();
+
+    // Append one sample: STRIP_SERIES values
+    void Add(const float *values);
+
+    // Copy the current window into the layer 0 back buffer
+    void Draw(LCD_DISCO_F429ZI &lcd);
+
+    // Chart row of a value (0 at the top), clamped to the chart
+    int Row(float value) const;
+
+private:
+    void RenderHead(const int *from, const int *to);
+
+    uint32_t buffer;   // SDRAM image, 2 x width columns of height pixels (0 if not allocated)
+    Surface canvas;    // The same image for drawing, in the layer 0 format
+    uint32_t fence;    // Last copy reading the canvas
+    uint32_t background, grid, colors[STRIP_SERIES]; // Pixel values in the layer 0 format
+    uint16_t x, y, width, height;
+    float min, max;
+    int head;          // Ring column of the newest sample
+    int last[STRIP_SERIES]; // Row of each series' previous sample, -1 before the first
+};
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef __SURFACE_H
+#define __SURFACE_H
+
+#include <stdint.h>
+
+/*
+  Direct view of a frame buffer: base address, size, stride and pixel format,
+  plus a clip rectangle.
+
+  The accessors are inline and take the pixel type as a template argument
+  (uint8_t, uint16_t or uint32_t for 1, 2 and 4 bytes per pixel). Drawing
+  code picks the type once per primitive, so a pixel then costs a store and a
+  pointer increment. Pixel() and Span() clip; Row() and At() do not and are
+  meant for loops whose range was clipped already. Rectangles and spans are
+  half-open: x0 <= x < x1. Nothing here depends on Mbed.
+
+  Example:
+      Surface s((void *)address, 240, 320, 240, LTDC_PIXEL_FORMAT_RGB565, 2);
+      s.SetClip(10, 10, 230, 160);
+      s.Span<uint16_t>(0, 240, 50, 0xF800); // Drawn from x = 10 to 229
+*/
+class Surface
+{
+public:
+    Surface() : base(0), width(0), height(0), pitch(0), format(0), size(0) { ResetClip(); }
+
+    // pitch: pixels from the start of one row to the next; size: bytes per pixel
+    Surface(void *base, int width, int height, int pitch, uint32_t format, int size)
+        : base((uint8_t *)base), width(width), height(height), pitch(pitch), format(format), size(size)
+    {
+        ResetClip();
+    }
+
+    int Width() const { return width; }
+    int Height() const { return height; }
+    int Pitch() const { return pitch; }
+    uint32_t Format() const { return format; }
+    int PixelSize() const { return size; }
+
+    // Limit drawing to the rectangle, cut to the surface
+    void SetClip(int x0, int y0, int x1, int y1)
+    {
+        clip_x0 = x0 < 0 ? 0 : x0;
+        clip_y0 = y0 < 0 ? 0 : y0;
+        clip_x1 = x1 > width ? width : x1;
+        clip_y1 = y1 > height ? height : y1;
+    }
+
+    void ResetClip() { SetClip(0, 0, width, height); }
+
+    int ClipX0() const { return clip_x0; }
+    int ClipY0() const { return clip_y0; }
+    int ClipX1() const { return clip_x1; }
+    int ClipY1() const { return clip_y1; }
+
+    // The pixel lies inside the clip rectangle
+    bool Contains(int x, int y) const
+    {
+        return x >= clip_x0 && x < clip_x1 && y >= clip_y0 && y < clip_y1;
+    }
+
+    // The rectangle lies entirely inside the clip rectangle
+    bool Contains(int x0, int y0, int x1, int y1) const
+    {
+        return x0 >= clip_x0 && x1 <= clip_x1 && y0 >= clip_y0 && y1 <= clip_y1;
+    }
+
+    // First pixel of row y, unclipped
+    template <typename P>
+    P *Row(int y) const { return (P *)base + y * pitch; }
+
+    // Pixel (x, y), unclipped
+    template <typename P>
+    P *At(int x, int y) const { return Row<P>(y) + x; }
+
+    // Write one pixel if it is inside the clip rectangle
+    template <typename P>
+    void Pixel(int x, int y, P value) const
+    {
+        if (Contains(x, y))
+            *At<P>(x, y) = value;
+    }
+
+    // Fill x0 <= x < x1 of row y, clipped
+    template <typename P>
+    void Span(int x0, int x1, int y, P value) const
+    {
+        if (y < clip_y0 || y >= clip_y1)
+            return;
+        if (x0 < clip_x0)
+            x0 = clip_x0;
+        if (x1 > clip_x1)
+            x1 = clip_x1;
+        for (P *p = At<P>(x0, y), *end = p + (x1 - x0); p < end; p++)
+            *p = value;
+    }
+
+private:
+    uint8_t *base;
+    int width, height;
+    int pitch;       // Pixels per row in memory
+    uint32_t format; // LTDC pixel format
+    int size;        // Bytes per pixel
+    int clip_x0, clip_y0, clip_x1, clip_y1;
+};
+
+#endif
@@ -0,0 +1,150 @@
+#include "Trajectory.h" // Include the header file for the dead-reckoning tracker
+
+Trajectory::Trajectory(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+    : view_x(x), view_y(y), view_w(width), view_h(height)
+{
+    Reset();
+}
+
+// Clear the path and restart at the origin facing up
+void Trajectory::Reset()
+{
+    step_count = 0;
+    heading = 0;
+    pos_x = 0;
+    pos_y = 0;
+    point_count = 0;
+    drawn_count = 0;
+    stride = 1;
+    AddPoint(0, 0); // Starting point
+    Fit();
+}
+
+// Integrate the heading and append a segment for every step
+void Trajectory::Update(const float *gyro_xyz, float dt, bool step)
+{
+    heading += gyro_xyz[2] * dt; // Integrate the yaw rate
+
+    if (!step)
+    {
+        return;
+    }
+    step_count++;
+
+    // Advance one step along the current heading (0 rad points up the screen)
+    pos_x += STEP_LENGTH * sinf(heading);
+    pos_y += STEP_LENGTH * cosf(heading);
+
+    if (step_count % stride == 0)
+    {
+        AddPoint(pos_x, pos_y);
+    }
+}
+
+// Store a position in centimetres, halving the list when it is full
+void Trajectory::AddPoint(float x, float y)
+{
+    if (point_count == TRACK_MAX_POINTS)
+    {
+        // Keep every other point; each stored point now spans twice as many steps
+        for (int i = 1; i < TRACK_MAX_POINTS / 2; i++)
+        {
+            points[i] = points[2 * i];
+        }
+        point_count = TRACK_MAX_POINTS / 2;
+        drawn_count = 0; // Force a full redraw
+        stride *= 2;
+    }
+
+    float cx = x * 100;
+    float cy = y * 100;
+    points[point_count].x = (int16_t)(cx > INT16_MAX ? INT16_MAX : (cx < INT16_MIN ? INT16_MIN : cx));
+    points[point_count].y = (int16_t)(cy > INT16_MAX ? INT16_MAX : (cy < INT16_MIN ? INT16_MIN : cy));
+    point_count++;
+}
+
+// Choose scale and origin so the whole path fits the viewport with room to grow
+void Trajectory::Fit()
+{
+    int16_t min_x = points[0].x, max_x = points[0].x;
+    int16_t min_y = points[0].y, max_y = points[0].y;
+    for (int i = 1; i < point_count; i++)
+    {
+        if (points[i].x < min_x) min_x = points[i].x;
+        if (points[i].x > max_x) max_x = points[i].x;
+        if (points[i].y < min_y) min_y = points[i].y;
+        if (points[i].y > max_y) max_y = points[i].y;
+    }
+
+    // Leave half the span again as headroom so rescaling stays rare
+    float span_x = (max_x - min_x) * 1.5f;
+    float span_y = (max_y - min_y) * 1.5f;
+    if (span_x < TRACK_MIN_SPAN) span_x = TRACK_MIN_SPAN;
+    if (span_y < TRACK_MIN_SPAN) span_y = TRACK_MIN_SPAN;
+
+    float scale_x = (view_w - 2 * TRACK_MARGIN) / span_x;
+    float scale_y = (view_h - 2 * TRACK_MARGIN) / span_y;
+    scale = scale_x < scale_y ? scale_x : scale_y;
+
+    origin_x = (min_x + max_x) * 0.5f;
+    origin_y = (min_y + max_y) * 0.5f;
+}
+
+// Map a path point to the screen; returns false if it falls outside the viewport
+bool Trajectory::ToScreen(const TrackPoint &p, int *sx, int *sy) const
+{
+    *sx = view_x + view_w / 2 + (int)((p.x - origin_x) * scale);
+    *sy = view_y + view_h / 2 - (int)((p.y - origin_y) * scale);
+
+    return *sx >= view_x + TRACK_MARGIN && *sx < view_x + view_w - TRACK_MARGIN &&
+           *sy >= view_y + TRACK_MARGIN && *sy < view_y + view_h - TRACK_MARGIN;
+}
+
+// Draw only the segments added since the previous call
+void Trajectory::Draw(LCD_DISCO_F429ZI &lcd)
+{
+    if (drawn_count == 0)
+    {
+        Redraw(lcd); // Nothing on screen yet (or the list was decimated)
+        return;
+    }
+
+    int x1, y1, x2, y2;
+    for (; drawn_count < point_count; drawn_count++)
+    {
+        bool inside = ToScreen(points[drawn_count - 1], &x1, &y1);
+        inside &= ToScreen(points[drawn_count], &x2, &y2);
+        if (!inside)
+        {
+            // The path left the viewport: rescale and re-render from the point list
+            Fit();
+            Redraw(lcd);
+            return;
+        }
+        lcd.DrawLine(x1, y1, x2, y2); // Draw the new segment
+    }
+}
+
+// Clear the viewport and draw the whole path
+void Trajectory::Redraw(LCD_DISCO_F429ZI &lcd)
+{
+    uint32_t text_color = lcd.GetTextColor();
+
+    // Clear the viewport
+    lcd.SetTextColor(lcd.GetBackColor());
+    lcd.FillRect(view_x, view_y, view_w, view_h);
+    lcd.SetTextColor(text_color);
+    lcd.DrawRect(view_x, view_y, view_w - 1, view_h - 1); // Viewport border
+
+    int x1, y1, x2, y2;
+    ToScreen(points[0], &x1, &y1);
+    lcd.DrawCircle(x1, y1, 2); // Mark the starting point
+    for (int i = 1; i < point_count; i++)
+    {
+        ToScreen(points[i], &x2, &y2);
+        lcd.DrawLine(x1, y1, x2, y2);
+        x1 = x2;
+        y1 = y2;
+    }
+    drawn_count = point_count;
+}
@@ -0,0 +1,69 @@
+#ifndef __TRAJECTORY_H
+#define __TRAJECTORY_H
+
+#include <mbed.h>
+#include "LCD_DISCO_F429ZI.h"
+
+/* Dead-reckoning constants */
+#define STEP_LENGTH       0.75f // Distance covered per detected step in metres
+#define TRACK_MAX_POINTS  256   // Points kept for re-rendering the path
+#define TRACK_MIN_SPAN    500   // Smallest area shown in the viewport in centimetres
+#define TRACK_MARGIN      4     // Free pixels kept around the path inside the viewport
+
+/*
+  2D dead-reckoning tracker.
+
+  The heading is integrated from the Z-axis (yaw) rate and one segment of
+  STEP_LENGTH is appended along the current heading for every step reported
+  by the caller (see StepStage).
+  Positions are kept as a compact list of centimetre points so the path can be
+  re-rendered when it no longer fits the viewport; otherwise Draw() only adds
+  the segments appended since the previous call.
+*/
+class Trajectory
+{
+public:
+    Trajectory(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+    // Clear the path and restart at the origin facing up
+    void Reset();
+
+    // Feed one gyro sample (rad/s) taken dt seconds after the previous one;
+    // step: the sample completes a step, which appends a new segment
+    void Update(const float *gyro_xyz, float dt, bool step);
+
+    // Draw the segments appended since the last call, rescaling if needed
+    void Draw(LCD_DISCO_F429ZI &lcd);
+
+    // Clear the viewport and draw the whole path
+    void Redraw(LCD_DISCO_F429ZI &lcd);
+
+    // Number of steps taken since the last Reset()
+    int Steps() const { return step_count; }
+
+private:
+    struct TrackPoint
+    {
+        int16_t x; // East offset in centimetres
+        int16_t y; // North offset in centimetres
+    };
+
+    void AddPoint(float x, float y);
+    void Fit();
+    bool ToScreen(const TrackPoint &p, int *sx, int *sy) const;
+
+    int step_count;      // Steps taken since the last Reset()
+    float heading;       // Integrated yaw in radians, 0 = up on screen
+    float pos_x, pos_y;  // Current position in metres
+
+    TrackPoint points[TRACK_MAX_POINTS];
+    int point_count;     // Points stored in points[]
+    int drawn_count;     // Points already rendered by Draw()
+    int stride;          // Steps represented by each stored point
+
+    uint16_t view_x, view_y, view_w, view_h; // Viewport on screen
+    float scale;                             // Pixels per centimetre
+    float origin_x, origin_y;                // Path coordinate shown at the viewport centre
+};
+
+#endif
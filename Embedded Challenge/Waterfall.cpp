@@ -0,0 +1,103 @@
+#include "Waterfall.h" // Include the header file for the spectrogram display
+
+/* Colour scale black -> blue -> cyan -> yellow -> red, built on first use */
+static uint32_t palette[256];
+static bool palette_ready = false;
+
+static void InitPalette()
+{
+    if (palette_ready)
+        return;
+
+    for (int i = 0; i < 256; i++)
+    {
+        int t = (i & 63) * 4; // Position inside the current segment (0..252)
+        uint32_t r, g, b;
+        switch (i >> 6)
+        {
+        case 0: r = 0;       g = 0;       b = t;       break; // Black to blue
+        case 1: r = 0;       g = t;       b = 255;     break; // Blue to cyan
+        case 2: r = t;       g = 255;     b = 255 - t; break; // Cyan to yellow
+        default: r = 255;    g = 255 - t; b = 0;       break; // Yellow to red
+        }
+        palette[i] = 0xFF000000 | (r << 16) | (g << 8) | b;
+    }
+    palette_ready = true;
+}
+
+Waterfall::Waterfall(uint16_t y, uint16_t height)
+    : image(BSP_LCD_GetXSize(), 2 * (height + 1)), y(y), width(BSP_LCD_GetXSize()), height(height), ring(height + 1) // Two copies of every row
+{
+    InitPalette();
+    Reset();
+}
+
+// Clear the history to the lowest colour
+void Waterfall::Reset()
+{
+    if (image.Valid())
+    {
+        Surface pixels = image.GetSurface();
+        for (int row = 0; row < 2 * ring; row++)
+        {
+            pixels.Span<uint32_t>(0, width, row, palette[0]);
+        }
+    }
+    top = 0;
+    reference = 0;
+    image.Pan(0, top);
+}
+
+// Write one frame as the new top row and scroll the layer by one row
+void Waterfall::AddRow(const float *power, int bins)
+{
+    uint8_t level[256];
+    if (!image.Valid())
+        return; // No canvas to draw into
+
+    if (bins > 256)
+        bins = 256;
+
+    // Auto-gain: follow the loudest bin, decaying slowly when the signal drops
+    reference *= WATERFALL_DECAY;
+    for (int k = 0; k < bins; k++)
+    {
+        if (power[k] > reference)
+            reference = power[k];
+    }
+
+    // Map each bin to a palette index on a logarithmic scale
+    for (int k = 0; k < bins; k++)
+    {
+        float db = power[k] > 0 && reference > 0 ? 10 * log10f(power[k] / reference) : -WATERFALL_RANGE_DB;
+        float t = 1 + db / WATERFALL_RANGE_DB;
+        level[k] = t <= 0 ? 0 : (t >= 1 ? 255 : (uint8_t)(t * 255));
+    }
+
+    // Move the window up one row; the new row is written into both copies,
+    // neither of which is inside the window still on screen
+    top = (top + ring - 1) % ring;
+    Surface pixels = image.GetSurface();
+    uint32_t *row = pixels.Row<uint32_t>(top);
+    uint32_t *copy = pixels.Row<uint32_t>(top + ring);
+    for (int x = 0; x < width; x++)
+    {
+        uint32_t color = palette[level[x * bins / width]];
+        row[x] = color;
+        copy[x] = color;
+    }
+
+    image.Pan(0, top); // Latched at the next vertical blanking to avoid tearing
+}
+
+// Enable the waterfall layer over the current screen
+void Waterfall::Show()
+{
+    image.Show(0, y, width, height);
+}
+
+// Disable the waterfall layer and restore the configuration set by LCD_DISCO_F429ZI
+void Waterfall::Hide()
+{
+    image.Hide();
+}
@@ -0,0 +1,49 @@
+#ifndef __WATERFALL_H
+#define __WATERFALL_H
+
+#include <mbed.h>
+#include "ScrollLayer.h"
+
+/* Waterfall constants */
+#define WATERFALL_RANGE_DB  30.0f // Power range mapped onto the colour scale
+#define WATERFALL_DECAY     0.98f // Per-row decay of the auto-gain reference
+
+/*
+  Scrolling spectrogram shown on the scroll layer (the spectrum view has no
+  chrome).
+
+  The image is a ScrollLayer canvas used as a ring of height + 1 ARGB8888
+  rows stored twice: row i and row i + height + 1 always hold the same data,
+  so any height consecutive rows form a contiguous picture. A new FFT frame
+  is written as one row (into both copies) and the display scrolls by
+  panning the canvas one row up. The spare ring row keeps both copies of the
+  new row outside the window shown until the pan latches. The newest row is
+  at the top of the window. Nothing is drawn if the canvas allocation failed.
+*/
+class Waterfall
+{
+public:
+    // y, height: screen rows covered by the waterfall (full screen width)
+    Waterfall(uint16_t y, uint16_t height);
+
+    // Clear the history to the lowest colour
+    void Reset();
+
+    // Append one frame of power values; bins are spread over the screen width
+    void AddRow(const float *power, int bins);
+
+    // Enable the waterfall layer with the next presented frame
+    void Show();
+
+    // Disable the waterfall layer with the next presented frame
+    void Hide();
+
+private:
+    ScrollLayer image; // 2 x ring rows of the screen width
+    uint16_t y, width, height;
+    uint16_t ring;     // Rows in the ring: height + 1
+    int top;           // Ring row currently shown at the top of the window
+    float reference;   // Auto-gain reference power (decaying maximum)
+};
+
+#endif
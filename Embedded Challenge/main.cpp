@@ -1,6 +1,14 @@
 #include <mbed.h>             // Include Mbed framework for ARM microcontrollers
 #include "I3G4250D.h"         // Include driver for I3G4250D gyroscope
 #include "LCD_DISCO_F429ZI.h" // Include driver for LCD_DISCO_F429ZI display
+#include "Trajectory.h"       // Include dead-reckoning path tracker
+#include "Spectrum.h"         // Include sliding-window frequency analysis
+#include "Waterfall.h"        // Include scrolling spectrogram display
+#include "StripChart.h"       // Include scrolling chart of the live samples
+#include "Activity.h"         // Include still/walk/run/stairs classifier
+#include "SessionStats.h"     // Include online session statistics
+#include "PipelineStages.h"   // Include compile-time processing stages
+#include "DistanceEstimator.h" // Include distance estimator comparison
 
 /* Global variables */
 static mbed::BufferedSerial serial_port(USBTX, USBRX); // Serial port for communication (e.g., with a PC)
@@ -9,23 +17,62 @@ static mbed::BufferedSerial serial_port(USBTX, USBRX); // Serial port for commun
 float samples[40][3];       // 40 samples, each with 3 axis readings
 float velo_samples[40][3];  // 40 samples of calculated velocities on 3 axes
 float distance_samples[40]; // 40 samples of calculated distances
+uint8_t activity_samples[40]; // 40 samples of the classified activity
 double global_distance = 0; // Total calculated distance
+sFONTA8 chart_font;          // Anti-aliased chart labels, blended over the chart lines
+bool chart_font_ready = false;
 
 /* Gyroscope radius constants */
 #define X 1
 #define Y 1
 #define Z 0.548
 
-/* Threshold constants for gyro data */
-#define MAX_THRESH 500
-#define MIN_THRESH -500
+/* Distance models selected by the activity classifier (raw distance per metre) */
+static const float distance_scale[ACTIVITY_COUNT] = {
+    0,     // Still: no distance
+    0.165, // Walk: the original calibration
+    0.120, // Run: longer strides for the same leg swing
+    0.250, // Stairs: little horizontal progress per step
+};
+#define DISTANCE_OFFSET 0.035 // Calibration offset in raw walking units
+
+/* Sampling constants */
+#define SAMPLE_PERIOD 20ms     // Gyro sampling period (50 Hz)
+#define SAMPLE_PERIOD_S 0.02f  // Gyro sampling period in seconds
+#define SAMPLES_PER_TICK 25    // Gyro samples per half-second display tick
+#define CHART_RANGE 5.0f       // Gyro range of the strip chart in rad/s (either sign)
+
+/* Live screen views, cycled with the button during a measurement */
+enum LiveView
+{
+    VIEW_VALUES,   // Gyro and velocity readings
+    VIEW_PATH,     // Dead-reckoned walking path
+    VIEW_SPECTRUM, // Spectrogram of the gyro axes
+    VIEW_STATS,    // Running session statistics
+    VIEW_CHART,    // Scrolling chart of the gyro axes
+    VIEW_COUNT
+};
+
+/* Per-sample processing: deadband and bias removal, spike rejection, step detection and axis statistics */
+typedef Pipeline<DeadbandStage, HampelStage, StepStage, AxisStatsStage> SamplePipeline;
+
+/* Per-tick processing: velocity, distance, storage of the session arrays and speed statistics */
+typedef Pipeline<VelocityStage, DistanceStage, RecordStage, SpeedStatsStage> TickPipeline;
 
 /* Function prototypes */
-void ProcessXYZ(float *gyro_xyz, float *velo_xyz, int half_second_count);
-void DisplayData(LCD_DISCO_F429ZI &lcd, float *gyro_xyz, float *velo_xyz, int half_second_count);
+void DisplayData(LCD_DISCO_F429ZI &lcd, float *gyro_xyz, float *velo_xyz, int half_second_count, ActivityType activity, bool visible);
 void DisplayDistance(LCD_DISCO_F429ZI &lcd);
+void DisplayHeaders(LCD_DISCO_F429ZI &lcd);
+void DisplayLiveDistance(LCD_DISCO_F429ZI &lcd, double distance);
+void DisplayPath(LCD_DISCO_F429ZI &lcd, Trajectory &trajectory, float cadence, bool redraw);
+void DisplaySpectrum(LCD_DISCO_F429ZI &lcd, Waterfall &waterfall, float bin_width);
+void DisplayStats(LCD_DISCO_F429ZI &lcd, const SessionStats &stats, bool redraw);
+void DisplayChart(LCD_DISCO_F429ZI &lcd, StripChart &chart);
+void PrintStats(const SessionStats &stats, const Spectrum &spectrum, int half_second_count, bool summary);
+void PrintEstimators(EstimatorRegistry &estimators);
 void DrawLineChart(LCD_DISCO_F429ZI &lcd, float *data, int data_length);
-void ClearScreen();
+void DrawChartLabel(LCD_DISCO_F429ZI &lcd, int x, int y, const char *text);
+void ClearScreen(LCD_DISCO_F429ZI &lcd);
 
 int main()
 {
@@ -54,41 +101,202 @@ int main()
     /* LCD Initialization */
     LCD_DISCO_F429ZI lcd;                   // Create LCD object
     int screen_height = BSP_LCD_GetYSize(); // Get LCD screen height
+    chart_font_ready = lcd.CreateFontA8(&Font24, 2, &chart_font) == LCD_OK; // 9x12 labels from Font24
+    lcd.EnableSwapChain(); // Draw off screen; each Present() shows a finished frame
+
+    // Path tracker drawn below the step counter on the path view
+    Trajectory trajectory(0, 30, BSP_LCD_GetXSize(), screen_height - 30);
+    Spectrum spectrum(1.0f / SAMPLE_PERIOD_S); // Cadence estimate from the gyro spectrum
+    Waterfall waterfall(30, screen_height - 30); // Spectrogram below the spectrum view title
+    StripChart chart(0, 30, BSP_LCD_GetXSize(), screen_height - 30, -CHART_RANGE, CHART_RANGE); // One column per sample
+    Activity activity;                            // Selects the distance model per tick
+    SessionStats stats;                           // Per-axis and speed statistics of the session
+    SamplePipeline sample_pipeline;               // Cleaning and step detection of each gyro sample
+    TickPipeline tick_pipeline;                   // Processing of each half-second tick
+
+    sample_pipeline.Get<AxisStatsStage>().Attach(stats.axis);
+
+    tick_pipeline.Get<VelocityStage>().SetRadius(X, Y, Z);
+    tick_pipeline.Get<DistanceStage>().SetModels(distance_scale, ACTIVITY_COUNT);
+    tick_pipeline.Get<DistanceStage>().SetOffset(DISTANCE_OFFSET / distance_scale[ACTIVITY_WALK]);
+    tick_pipeline.Get<RecordStage>().Attach(samples, velo_samples, distance_samples, activity_samples, 40);
+    tick_pipeline.Get<SpeedStatsStage>().Attach(&stats.speed);
+
+    // Distance estimators compared on the same sample stream
+    LegacyEstimator legacy_estimator(distance_scale, ACTIVITY_COUNT, DISTANCE_OFFSET / distance_scale[ACTIVITY_WALK]);
+    StepEstimator step_estimator;
+    IntegrationEstimator integration_estimator;
+    EstimatorRegistry estimators;
+    estimators.Add(&legacy_estimator);
+    estimators.Add(&step_estimator);
+    estimators.Add(&integration_estimator);
 
     while (true)
     {
         bool stay = true;
+        bool button_was_pressed = true;           // The start press must be released before toggling views
+        LiveView view = VIEW_VALUES;              // View shown during the measurement
+        int sample_count = 0;                     // Samples taken since the last display tick
+        int idle_count = 0;                       // Samples of this tick entirely inside the deadband
+        Kernel::Clock::time_point next_sample;    // Deadline of the next gyro sample
         // Wait for user to press button
-        ClearScreen(); // Clear the LCD screen
+        ClearScreen(lcd); // Clear the LCD screen
         // Display instructions on the LCD
         BSP_LCD_SetFont(&Font20); // Set font size to 20
         lcd.DisplayStringAt(0, screen_height / 2 - 150, (uint8_t *)"Press the blue", LEFT_MODE);
         lcd.DisplayStringAt(0, screen_height / 2 - 120, (uint8_t *)"button to start.", LEFT_MODE);
+        lcd.Present();
         while (!BUTTON.read())
             ; // Wait until the button is pressed
 
         // Initialize screen with different sections for displaying data
-        ClearScreen();            // Clear the screen for new data display
-        BSP_LCD_SetFont(&Font20); // Set font size to 20
-        // Display headers for different data sections
-        lcd.DisplayStringAt(0, screen_height / 2 - 150, (uint8_t *)"Gyro values", CENTER_MODE);
-        lcd.DisplayStringAt(0, screen_height / 2 - 20, (uint8_t *)"Linear Velocity", CENTER_MODE);
-        lcd.DisplayStringAt(0, screen_height / 2 + 110, (uint8_t *)"Time passed", CENTER_MODE);
+        DisplayHeaders(lcd);
+        DisplayLiveDistance(lcd, 0);
+        lcd.Present();
+        trajectory.Reset();          // Start a new path
+        spectrum.Reset();            // Drop the previous session's samples
+        waterfall.Reset();           // Clear the spectrogram history
+        chart.Reset();               // Clear the strip chart history
+        activity.Reset();            // Start the session as standing still
+        sample_pipeline.Reset();     // Do not carry samples over from the last session (keeps the noise floor)
+        stats.Reset();               // Start new session statistics
+        tick_pipeline.Reset();       // Zero velocity and distance
+        estimators.Reset();          // Zero the compared distances and their cycle counts
         ThisThread::sleep_for(1000); // Pause for a second
+        next_sample = Kernel::Clock::now();
 
         while (stay)
         {
-            ReadXYZ(spi, CS, gyro_xyz);                        // Read gyro data
-            ProcessXYZ(gyro_xyz, velo_xyz, half_second_count); // Process the data
+            ReadXYZ(spi, CS, gyro_xyz); // Read gyro data
+            if (half_second_count < 40)
+            {
+                // Zero out stationary noise, remove the sensor bias and glitches, detect steps;
+                // the cleaned sample is delayed by the spike filter
+                PipelineSample frame = {};
+                for (int i = 0; i < 3; i++)
+                {
+                    frame.gyro[i] = gyro_xyz[i];
+                }
+                frame.dt = SAMPLE_PERIOD_S;
+                frame.index = half_second_count * SAMPLES_PER_TICK + sample_count;
+                sample_pipeline.Process(frame);
+                for (int i = 0; i < 3; i++)
+                {
+                    gyro_xyz[i] = frame.gyro[i];
+                }
+                if (frame.idle)
+                {
+                    idle_count++;
+                }
+
+                // Track heading and steps at the full sampling rate; gated samples
+                // still pass so the heading runs through pauses
+                trajectory.Update(gyro_xyz, SAMPLE_PERIOD_S, frame.step);
+                if (frame.step && view == VIEW_PATH)
+                {
+                    DisplayPath(lcd, trajectory, spectrum.Cadence(), false); // Draw only the new segment
+                    lcd.Present();
+                }
+
+                // Frequency analysis, one axis per sample so a frame never stalls sampling
+                spectrum.Push(gyro_xyz);
+                if (spectrum.Process())
+                {
+                    // One new spectrogram row per completed frame (lower half of the bins)
+                    waterfall.AddRow(spectrum.Power(), SPECTRUM_BINS / 2);
+                }
+                activity.Update(gyro_xyz, spectrum.Cadence()); // Incremental features, classified every half window
+
+                // Feed the same frame to every distance estimator
+                frame.activity = activity.Current();
+                estimators.Update(frame);
+
+                // One new chart column per sample; the view shows it at once
+                chart.Add(gyro_xyz);
+                if (view == VIEW_CHART)
+                {
+                    chart.Draw(lcd);
+                    lcd.Present();
+                }
+
+                // A button press switches to the next view
+                bool button_pressed = BUTTON.read();
+                if (button_pressed && !button_was_pressed)
+                {
+                    if (view == VIEW_SPECTRUM)
+                        waterfall.Hide(); // Leaving the spectrum view
+                    view = (LiveView)((view + 1) % VIEW_COUNT);
+                    if (view == VIEW_VALUES)
+                    {
+                        DisplayHeaders(lcd);
+                        DisplayLiveDistance(lcd, tick_pipeline.Get<DistanceStage>().Distance());
+                    }
+                    else if (view == VIEW_PATH)
+                        DisplayPath(lcd, trajectory, spectrum.Cadence(), true);
+                    else if (view == VIEW_SPECTRUM)
+                        DisplaySpectrum(lcd, waterfall, spectrum.BinWidth());
+                    else if (view == VIEW_STATS)
+                        DisplayStats(lcd, stats, true);
+                    else
+                        DisplayChart(lcd, chart);
+                    lcd.Present();
+                }
+                button_was_pressed = button_pressed;
+
+                // Process and display only once per half-second tick
+                next_sample += SAMPLE_PERIOD;
+                if (++sample_count < SAMPLES_PER_TICK)
+                {
+                    ThisThread::sleep_until(next_sample);
+                    continue;
+                }
+                sample_count = 0;
+            }
+
             if (half_second_count < 40)
             {
+                bool idle_tick = idle_count == SAMPLES_PER_TICK;
+                idle_count = 0;
+
+                // Velocity, distance, storage and speed statistics of this tick from its newest
+                // cleaned sample, all zeros when the whole tick was inside the deadband
+                PipelineSample tick = {};
+                for (int i = 0; i < 3; i++)
+                {
+                    tick.gyro[i] = gyro_xyz[i];
+                }
+                tick.dt = SAMPLES_PER_TICK * SAMPLE_PERIOD_S;
+                tick.index = half_second_count;
+                tick.activity = activity.Current();
+                tick.idle = idle_tick; // No velocity difference across the gated zeros
+                estimators.UpdateTick(tick); // The legacy estimator sees exactly this tick
+                tick_pipeline.Process(tick);
+                for (int i = 0; i < 3; i++)
+                {
+                    velo_xyz[i] = tick.velocity[i];
+                }
+
+                PrintStats(stats, spectrum, half_second_count, false);
+
                 // If less than 20 seconds have passed, display current data
-                DisplayData(lcd, gyro_xyz, velo_xyz, half_second_count);
+                DisplayData(lcd, gyro_xyz, velo_xyz, half_second_count, activity.Current(), view == VIEW_VALUES);
+                if (view == VIEW_VALUES)
+                    DisplayLiveDistance(lcd, tick_pipeline.Get<DistanceStage>().Distance());
+                else if (view == VIEW_PATH)
+                    DisplayPath(lcd, trajectory, spectrum.Cadence(), false); // Refresh the cadence
+                else if (view == VIEW_STATS)
+                    DisplayStats(lcd, stats, false);
+                lcd.Present(); // Show the tick's updates together
             }
             else if (half_second_count == 40)
             {
-                // At 20 seconds, display the total distance
+                // At 20 seconds, display the total distance, already accumulated tick by tick
+                global_distance = tick_pipeline.Get<DistanceStage>().Distance();
+                waterfall.Hide();
                 DisplayDistance(lcd);
+                lcd.Present();
+                PrintStats(stats, spectrum, half_second_count, true);
+                PrintEstimators(estimators);
                 half_second_count++;
             }
             else
@@ -103,48 +311,18 @@ int main()
             }
             half_second_count++;
             if (half_second_count <= 40)
-                ThisThread::sleep_for(500); // Wait half a second between readings
+                ThisThread::sleep_until(next_sample); // Wait for the next sample slot
             else
                 ThisThread::sleep_for(3); // Shorter delay after 20 seconds
         }
     }
 }
-// ProcessXYZ function implementation
-void ProcessXYZ(float *gyro_xyz, float *velo_xyz, int half_second_count)
-{
-    // Processes the raw gyroscopic data to calculate linear velocity
-
-    // Check if gyro data is within the defined thresholds
-    for (int i = 0; i < 3; i++)
-    {
-        if (gyro_xyz[i] > MAX_THRESH || gyro_xyz[i] < MIN_THRESH)
-        {
-            gyro_xyz[i] = 0; // Set out-of-range values to zero
-        }
-    }
-
-    // Calculate linear velocity
-    if (half_second_count == 0)
-    {
-        // If this is the first reading, set initial velocity to zero
-        velo_xyz[0] = 0;
-        velo_xyz[1] = 0;
-        velo_xyz[2] = 0;
-    }
-    else
-    {
-        // Calculate linear velocity from angular velocity and radius
-        // Linear velocity = angular velocity * radius
-        velo_xyz[0] = (samples[half_second_count - 1][0] - gyro_xyz[0]) * X;
-        velo_xyz[1] = (samples[half_second_count - 1][1] - gyro_xyz[1]) * Y;
-        velo_xyz[2] = (samples[half_second_count - 1][2] - gyro_xyz[2]) * Z;
-    }
-}
 
 // DisplayData function implementation
-void DisplayData(LCD_DISCO_F429ZI &lcd, float *gyro_xyz, float *velo_xyz, int half_second_count)
+void DisplayData(LCD_DISCO_F429ZI &lcd, float *gyro_xyz, float *velo_xyz, int half_second_count, ActivityType activity, bool visible)
 {
-    // Displays the current gyroscopic data and calculated velocity on the LCD screen
+    // Displays the current gyroscopic data, calculated velocity and activity
+    // on the LCD screen if the values view is visible
 
     // Variables for formatting the display strings
     char gyro_x[30] = {0};
@@ -155,14 +333,10 @@ void DisplayData(LCD_DISCO_F429ZI &lcd, float *gyro_xyz, float *velo_xyz, int ha
     char y_velo[30] = {0};
     char z_velo[30] = {0};
 
-    char time_display[15] = {0};
+    char time_display[25] = {0};
 
-    // Accumulate data until 20 seconds
-    for (int i = 0; i < 3; i++)
-    {
-        samples[half_second_count][i] = gyro_xyz[i] = gyro_xyz[i];
-        velo_samples[half_second_count][i] = velo_xyz[i];
-    }
+    if (!visible)
+        return; // Another view is on screen
 
     // Format and display gyroscopic data on the LCD
     sprintf(gyro_x, "X Raw_S: %5.2f", gyro_xyz[0]); // Format X-axis gyro data
@@ -174,45 +348,197 @@ void DisplayData(LCD_DISCO_F429ZI &lcd, float *gyro_xyz, float *velo_xyz, int ha
     sprintf(y_velo, "Y Lin_S: %5.2f", velo_xyz[1]); // Format Y-axis velocity
     sprintf(z_velo, "Z Lin_S: %5.2f", velo_xyz[2]); // Format Z-axis velocity
 
-    // Display time passed since the start of measurements
-    sprintf(time_display, "%5.2f s", half_second_count * 0.5); // Calculate and format time
+    // Display time passed since the start of measurements and the current activity
+    sprintf(time_display, "%5.2f s %-6s", half_second_count * 0.5, Activity::Name(activity)); // Fixed width keeps the centred text in place
 
     // Get screen height for positioning the text
     int screen_height = BSP_LCD_GetYSize();
 
-    // Display the formatted strings on the LCD
-    lcd.DisplayStringAt(0, screen_height / 2 - 120, (uint8_t *)gyro_x, LEFT_MODE);
-    lcd.DisplayStringAt(0, screen_height / 2 - 90, (uint8_t *)gyro_y, LEFT_MODE);
-    lcd.DisplayStringAt(0, screen_height / 2 - 60, (uint8_t *)gyro_z, LEFT_MODE);
+    // Display the formatted strings on the LCD; only changed characters are redrawn
+    lcd.DisplayLabelAt(0, screen_height / 2 - 120, (uint8_t *)gyro_x, LEFT_MODE);
+    lcd.DisplayLabelAt(0, screen_height / 2 - 90, (uint8_t *)gyro_y, LEFT_MODE);
+    lcd.DisplayLabelAt(0, screen_height / 2 - 60, (uint8_t *)gyro_z, LEFT_MODE);
 
-    lcd.DisplayStringAt(0, screen_height / 2 + 10, (uint8_t *)x_velo, LEFT_MODE);
-    lcd.DisplayStringAt(0, screen_height / 2 + 40, (uint8_t *)y_velo, LEFT_MODE);
-    lcd.DisplayStringAt(0, screen_height / 2 + 70, (uint8_t *)z_velo, LEFT_MODE);
+    lcd.DisplayLabelAt(0, screen_height / 2 + 10, (uint8_t *)x_velo, LEFT_MODE);
+    lcd.DisplayLabelAt(0, screen_height / 2 + 40, (uint8_t *)y_velo, LEFT_MODE);
+    lcd.DisplayLabelAt(0, screen_height / 2 + 70, (uint8_t *)z_velo, LEFT_MODE);
 
     // Display the calculated time
-    lcd.DisplayStringAt(0, screen_height / 2 + 140, (uint8_t *)time_display, CENTER_MODE);
+    lcd.DisplayLabelAt(0, screen_height / 2 + 110, (uint8_t *)time_display, CENTER_MODE);
+}
+
+// DisplayHeaders function implementation
+void DisplayHeaders(LCD_DISCO_F429ZI &lcd)
+{
+    // Clears the screen and draws the section headers of the values view on
+    // the chrome layer, so the ticks only redraw the values below them
+
+    int screen_height = BSP_LCD_GetYSize();
+
+    ClearScreen(lcd);         // Clear the screen for new data display
+    lcd.BeginChrome();
+    BSP_LCD_SetFont(&Font20); // Set font size to 20
+    // Display headers for different data sections
+    lcd.DisplayStringAt(0, screen_height / 2 - 150, (uint8_t *)"Gyro values", CENTER_MODE);
+    lcd.DisplayStringAt(0, screen_height / 2 - 20, (uint8_t *)"Linear Velocity", CENTER_MODE);
+    lcd.EndChrome();
+}
+
+// DisplayLiveDistance function implementation
+void DisplayLiveDistance(LCD_DISCO_F429ZI &lcd, double distance)
+{
+    // Displays the distance accumulated so far below the time on the values view;
+    // the label is only redrawn where the shown digits change
+
+    char distance_display[20] = {0};
+
+    sprintf(distance_display, "%6.2f m", distance);
+    BSP_LCD_SetFont(&Font20);
+    lcd.DisplayLabelAt(0, BSP_LCD_GetYSize() / 2 + 140, (uint8_t *)distance_display, CENTER_MODE);
+}
+
+// DisplayPath function implementation
+void DisplayPath(LCD_DISCO_F429ZI &lcd, Trajectory &trajectory, float cadence, bool redraw)
+{
+    // Displays the step count, the cadence and the dead-reckoned path
+
+    char steps_display[30] = {0};
+
+    if (redraw)
+    {
+        ClearScreen(lcd);
+        trajectory.Redraw(lcd); // Render the whole path from the point list
+    }
+    else
+    {
+        trajectory.Draw(lcd); // Render only the segments added since the last call
+    }
+
+    BSP_LCD_SetFont(&Font16);
+    sprintf(steps_display, "Steps %3d %4.0f/min", trajectory.Steps(), cadence * 60); // Cadence in steps per minute
+    lcd.DisplayLabelAt(0, 7, (uint8_t *)steps_display, CENTER_MODE);
+}
+
+// DisplaySpectrum function implementation
+void DisplaySpectrum(LCD_DISCO_F429ZI &lcd, Waterfall &waterfall, float bin_width)
+{
+    // Displays the spectrum view title and enables the waterfall layer below it
+
+    char title[30] = {0};
+
+    ClearScreen(lcd);
+    BSP_LCD_SetFont(&Font16);
+    sprintf(title, "Spectrum 0-%.1f Hz", bin_width * SPECTRUM_BINS / 2); // Frequency range across the screen
+    lcd.DisplayStringAt(0, 7, (uint8_t *)title, CENTER_MODE);
+    waterfall.Show();
+}
+
+// DisplayChart function implementation
+void DisplayChart(LCD_DISCO_F429ZI &lcd, StripChart &chart)
+{
+    // Displays the chart view title and the current chart window below it
+
+    ClearScreen(lcd);
+    lcd.BeginChrome();
+    BSP_LCD_SetFont(&Font16);
+    BSP_LCD_SetTextColor(LCD_COLOR_RED);
+    lcd.DisplayStringAt(40, 7, (uint8_t *)"X", LEFT_MODE);
+    BSP_LCD_SetTextColor(LCD_COLOR_GREEN);
+    lcd.DisplayStringAt(60, 7, (uint8_t *)"Y", LEFT_MODE);
+    BSP_LCD_SetTextColor(LCD_COLOR_BLUE);
+    lcd.DisplayStringAt(80, 7, (uint8_t *)"Z", LEFT_MODE);
+    BSP_LCD_SetTextColor(LCD_COLOR_BLACK);
+    lcd.DisplayStringAt(100, 7, (uint8_t *)"rad/s", LEFT_MODE);
+    lcd.EndChrome();
+    chart.Draw(lcd);
+}
+
+// DisplayStats function implementation
+void DisplayStats(LCD_DISCO_F429ZI &lcd, const SessionStats &stats, bool redraw)
+{
+    // Displays mean, standard deviation and extremes of each axis and of the speed
+
+    static const char *const names[4] = {"X", "Y", "Z", "V"};
+    char line[30] = {0};
+
+    BSP_LCD_SetFont(&Font16);
+    if (redraw)
+    {
+        ClearScreen(lcd);
+        lcd.BeginChrome();
+        BSP_LCD_SetFont(&Font16);
+        lcd.DisplayStringAt(0, 7, (uint8_t *)"Session stats", CENTER_MODE);
+        lcd.EndChrome();
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+        const RunningStats &s = i < 3 ? stats.axis[i] : stats.speed;
+        int y = 40 + i * 60;
+
+        sprintf(line, "%s mean %5.2f sd %4.2f", names[i], s.Mean(), s.StdDev());
+        lcd.DisplayLabelAt(0, y, (uint8_t *)line, LEFT_MODE);
+        sprintf(line, "  min %5.2f max %5.2f", s.Min(), s.Max());
+        lcd.DisplayLabelAt(0, y + 20, (uint8_t *)line, LEFT_MODE);
+    }
+
+    sprintf(line, "%lu samples", (unsigned long)stats.axis[0].Count());
+    lcd.DisplayLabelAt(0, BSP_LCD_GetYSize() - 30, (uint8_t *)line, CENTER_MODE);
+}
+
+// PrintStats function implementation
+void PrintStats(const SessionStats &stats, const Spectrum &spectrum, int half_second_count, bool summary)
+{
+    // Sends the statistics over the serial port: one line per tick with the
+    // speed, the cadence and the cadence band energy, and every axis at the
+    // end of the session
+
+    static const char *const names[4] = {"x", "y", "z", "speed"};
+    char line[120];
+    int length;
+
+    if (!summary)
+    {
+        length = snprintf(line, sizeof(line), "t=%.1f speed mean=%.2f sd=%.2f max=%.2f cadence=%.2f energy=%.4g\r\n",
+                          half_second_count * 0.5, stats.speed.Mean(), stats.speed.StdDev(), stats.speed.Max(),
+                          spectrum.Cadence(), spectrum.Energy());
+        serial_port.write(line, length);
+        return;
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+        const RunningStats &s = i < 3 ? stats.axis[i] : stats.speed;
+        length = snprintf(line, sizeof(line), "%s n=%lu mean=%.3f sd=%.3f min=%.3f max=%.3f\r\n", names[i],
+                          (unsigned long)s.Count(), s.Mean(), s.StdDev(), s.Min(), s.Max());
+        serial_port.write(line, length);
+    }
+}
+
+// PrintEstimators function implementation
+void PrintEstimators(EstimatorRegistry &estimators)
+{
+    // Sends the distance and the average CPU cycles per sample of every
+    // registered estimator over the serial port
+
+    char line[60];
+    for (int i = 0; i < estimators.Count(); i++)
+    {
+        int length = snprintf(line, sizeof(line), "%-10s %6.2f m %6lu cycles\r\n", estimators.Get(i).Name(),
+                              estimators.Get(i).Distance(), (unsigned long)estimators.CyclesPerFrame(i));
+        serial_port.write(line, length);
+    }
 }
 
 // DisplayDistance function implementation
 void DisplayDistance(LCD_DISCO_F429ZI &lcd)
 {
-    // Calculate and display the total distance based on velocity data
+    // Display the calibrated total distance accumulated by the tick pipeline
+    // and the distance of every tick recorded in distance_samples
 
     char distance_display[25]; // String to display the distance
-    // Iterate over each velocity sample to calculate distance
-    for (int i = 0; i < 40; i++)
-    {
-        // Distance calculation: velocity * time (0.5 seconds per sample)
-        float x_dist = velo_samples[i][0] * 0.5;
-        float y_dist = velo_samples[i][1] * 0.5;
-        float z_dist = velo_samples[i][2] * 0.5;
-
-        // Calculate the distance for this sample
-        distance_samples[i] = sqrt(x_dist * x_dist);
-        global_distance += distance_samples[i]; // Add to total distance
-    }
 
-    // Calibration and display of total distance
+    // Display of total distance
     int screen_height = BSP_LCD_GetYSize();
     DrawLineChart(lcd, distance_samples, 40); // Draw a line chart of distance over time
 
@@ -227,14 +553,6 @@ void DisplayDistance(LCD_DISCO_F429ZI &lcd)
     // Display instructions for restarting the measurement
     lcd.DisplayStringAt(0, screen_height / 2 + 100, (uint8_t *)"Press again", LEFT_MODE);
     lcd.DisplayStringAt(0, screen_height / 2 + 140, (uint8_t *)"to restart.", LEFT_MODE);
-
-    // Perform a calibration offset and scaling on the total distance
-    global_distance -= 0.035; // Offset adjustment
-    if (global_distance < 0)
-    {
-        global_distance = 0; // Ensure distance doesn't go negative
-    }
-    global_distance /= 0.165; // Scaling factor
 }
 
 // DrawLineChart function implementation
@@ -242,7 +560,7 @@ void DrawLineChart(LCD_DISCO_F429ZI &lcd, float *data, int data_length)
 {
     // Draws a line chart on the LCD based on the provided data
 
-    ClearScreen(); // Clear the LCD screen before drawing the chart
+    ClearScreen(lcd); // Clear the LCD screen before drawing the chart
 
     // Determine the maximum Y value for the chart scale
     float maxYValue = data[0] * 100;
@@ -254,29 +572,32 @@ void DrawLineChart(LCD_DISCO_F429ZI &lcd, float *data, int data_length)
         }
     }
 
+    // Axes, ticks and labels do not change: draw them on the chrome layer
+    lcd.BeginChrome();
+
     // Draw the axes for the line chart
     int screen_height = BSP_LCD_GetYSize();
-    BSP_LCD_DrawLine(10, 10, 10, screen_height / 2 - 10);                                          // Draw Y-axis
-    BSP_LCD_DrawLine(10, screen_height / 2 - 10, BSP_LCD_GetXSize() - 10, screen_height / 2 - 10); // Draw X-axis
+    lcd.DrawLine(10, 10, 10, screen_height / 2 - 10);                                          // Draw Y-axis
+    lcd.DrawLine(10, screen_height / 2 - 10, BSP_LCD_GetXSize() - 10, screen_height / 2 - 10); // Draw X-axis
 
     // Set font for axis labels
     BSP_LCD_SetFont(&Font16);
     // Display axis labels
-    BSP_LCD_DisplayStringAt(BSP_LCD_GetXSize() - 90, screen_height / 2 + 10, (uint8_t *)"x (0.5s)", LEFT_MODE);
-    BSP_LCD_DisplayStringAt(40, 0, (uint8_t *)"y (cm)", LEFT_MODE);
+    DrawChartLabel(lcd, BSP_LCD_GetXSize() - 90, screen_height / 2 + 10, "x (0.5s)");
+    DrawChartLabel(lcd, 40, 0, "y (cm)");
 
     // Draw tick marks and labels on X-axis
     for (int i = 0; i <= 40; i += 5)
     {
         int x = 10 + (i * (BSP_LCD_GetXSize() - 20) / 40);                     // Calculate X position for tick mark
-        BSP_LCD_DrawLine(x, screen_height / 2 - 10, x, screen_height / 2 - 5); // Draw tick mark
+        lcd.DrawLine(x, screen_height / 2 - 10, x, screen_height / 2 - 5); // Draw tick mark
 
         char str[10];
         sprintf(str, "%d", i);                                                             // Format tick label
-        BSP_LCD_DisplayStringAt(x - 10, screen_height / 2 - 5, (uint8_t *)str, LEFT_MODE); // Display label
+        DrawChartLabel(lcd, x - 10, screen_height / 2 - 5, str);                          // Display label
     }
 
-    // Draw line chart based on data
+    // Draw tick marks and labels on Y-axis
     if (maxYValue >= 1)
     {
         int numYTicks = 5; // Number of Y-axis tick marks
@@ -285,13 +606,18 @@ void DrawLineChart(LCD_DISCO_F429ZI &lcd, float *data, int data_length)
             float yValue = (maxYValue / numYTicks) * i;
             int y = screen_height / 2 - 10 - (int)((yValue / maxYValue) * (screen_height / 2 - 20));
 
-            BSP_LCD_DrawLine(5, y, 10, y); // Draw Y-axis tick mark
+            lcd.DrawLine(5, y, 10, y); // Draw Y-axis tick mark
 
             char str[10];
             sprintf(str, "%.0f", yValue);                                   // Format Y-axis tick label
-            BSP_LCD_DisplayStringAt(12, y - 10, (uint8_t *)str, LEFT_MODE); // Display label
+            DrawChartLabel(lcd, 12, y - 10, str);                           // Display label
         }
-        // Draw the actual line chart
+    }
+    lcd.EndChrome();
+
+    // Draw the actual line chart on layer 0
+    if (maxYValue >= 1)
+    {
         for (int i = 0; i < data_length - 1; i++)
         {
             int x1 = 10 + (i * (BSP_LCD_GetXSize() - 20) / 40);
@@ -300,16 +626,32 @@ void DrawLineChart(LCD_DISCO_F429ZI &lcd, float *data, int data_length)
             int x2 = 10 + ((i + 1) * (BSP_LCD_GetXSize() - 20) / 40);
             int y2 = screen_height / 2 - 10 - (int)((data[i + 1] * 100 / maxYValue) * (screen_height / 2 - 20));
 
-            BSP_LCD_DrawLine(x1, y1, x2, y2); // Draw line segment
+            lcd.DrawLineAA(x1, y1, x2, y2); // Draw line segment, anti-aliased
         }
     }
 }
 
-void ClearScreen()
+void ClearScreen(LCD_DISCO_F429ZI &lcd)
 {
     // Clears the LCD screen to prepare for new content
 
-    BSP_LCD_Clear(LCD_COLOR_WHITE);        // Set screen background to white
+    lcd.Clear(LCD_COLOR_WHITE);            // Set screen background to white (also forgets the drawn labels)
+    lcd.ClearChrome();                     // Remove the previous screen's chrome with the next frame
     BSP_LCD_SetBackColor(LCD_COLOR_WHITE); // Set background color for text
     BSP_LCD_SetTextColor(LCD_COLOR_BLACK); // Set text color to black
-}
\ No newline at end of file
+}
+
+// DrawChartLabel function implementation
+void DrawChartLabel(LCD_DISCO_F429ZI &lcd, int x, int y, const char *text)
+{
+    // Draws a chart label with the anti-aliased font, keeping the chart visible around
+    // the glyphs; falls back to the current bitmap font when SDRAM had no room for it
+    if (chart_font_ready)
+    {
+        lcd.DisplayStringAtA8(x, y, &chart_font, (uint8_t *)text, LEFT_MODE);
+    }
+    else
+    {
+        lcd.DisplayStringAt(x, y, (uint8_t *)text, LEFT_MODE);
+    }
+}
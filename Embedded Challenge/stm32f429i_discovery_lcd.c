@@ -74,6 +74,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f429i_discovery_lcd.h"
 #include "Fonts/fonts.h"
+#include "cmsis_nvic.h" // Added for mbed (NVIC_SetVector)
 //#include "Fonts/font24.c"
 //#include "Fonts/font20.c"
 //#include "Fonts/font16.c"
@@ -96,6 +97,40 @@
 /** @defgroup STM32F429I_DISCOVERY_LCD_Private_TypesDefinitions STM32F429I DISCOVERY LCD Private TypesDefinitions
   * @{
   */ 
+typedef struct
+{
+  const uint8_t *pGlyph;   /* Font bitmap of the cached glyph, NULL when the slot is empty */
+  uint32_t TextColor;
+  uint32_t BackColor;
+  uint32_t PixelFormat;    /* Layer pixel format the glyph was rasterized in */
+  uint32_t Fence;          /* Last queued blit reading the slot */
+} LCD_GlyphTypeDef;
+
+typedef struct
+{
+  uint32_t Mode;           /* DMA2D_R2M, DMA2D_M2M, DMA2D_M2M_PFC or DMA2D_M2M_BLEND */
+  uint32_t InputColorMode; /* Foreground color mode (memory to memory modes) */
+  uint32_t OutputColorMode; /* Output color mode, also the background's when blending */
+  uint32_t Src;            /* Fill color (R2M) or foreground address */
+  uint32_t Dst;            /* Output address, also the background when blending */
+  uint32_t Width;
+  uint32_t Height;
+  uint32_t OffLine;        /* Output and background line offset */
+  uint32_t SrcOffLine;     /* Foreground line offset */
+  uint32_t Color;          /* Fixed foreground color of A8 masks */
+} LCD_Dma2dOpTypeDef;
+
+typedef struct
+{
+  uint32_t Valid;          /* The fields below match the DMA2D registers */
+  uint32_t OPFCCR;
+  uint32_t OOR;
+  uint32_t FGPFCCR;
+  uint32_t FGCOLR;
+  uint32_t FGOR;
+  uint32_t BGPFCCR;
+  uint32_t BGOR;
+} LCD_Dma2dRegsTypeDef;
 /**
   * @}
   */ 
@@ -121,13 +156,44 @@
   * @{
   */ 
 LTDC_HandleTypeDef  LtdcHandler;
-static DMA2D_HandleTypeDef Dma2dHandler;
 static RCC_PeriphCLKInitTypeDef  PeriphClkInitStruct;
 
 /* Default LCD configuration with LCD Layer 1 */
 static uint32_t ActiveLayer = 0;
 static LCD_DrawPropTypeDef DrawProp[MAX_LAYER_NUMBER];
 LCD_DrvTypeDef  *LcdDrv;
+
+/* Glyph cache: slot i holds the pixels (in the layer format) of GlyphCache[i] at GlyphCacheAddress + i * LCD_GLYPH_SLOT_SIZE */
+static LCD_GlyphTypeDef GlyphCache[LCD_GLYPH_CACHE_SLOTS];
+static uint32_t GlyphCacheAddress = 0;
+static uint8_t GlyphCacheState = 0;   /* 0: not allocated yet, 1: ready, 2: no SDRAM left */
+
+/* DMA2D queue: operation n (counted from 1, its fence) lives in Dma2dQueue[(n - 1) % LCD_DMA2D_QUEUE_SIZE] */
+static LCD_Dma2dOpTypeDef Dma2dQueue[LCD_DMA2D_QUEUE_SIZE];
+static volatile uint32_t Dma2dQueued = 0;      /* Operations queued */
+static volatile uint32_t Dma2dStarted = 0;     /* Operations handed to the DMA2D */
+static volatile uint32_t Dma2dCompleted = 0;   /* Operations finished (or failed to start) */
+static LCD_Dma2dRegsTypeDef Dma2dRegs;         /* Configuration left in the DMA2D by the last operation */
+
+/* Swap chain: indexes into SwapBuffers, -1 for none */
+static uint32_t SwapLayer = 0;
+static uint32_t SwapBuffers[LCD_SWAP_BUFFERS_MAX];
+static uint32_t SwapCount = 0;                 /* 0 while drawing straight to the visible buffer */
+static int32_t SwapBack = -1;                  /* Buffer being drawn */
+static volatile int32_t SwapFront = -1;        /* Buffer on screen */
+static volatile int32_t SwapPending = -1;      /* Buffer presented, latched by the next line interrupt */
+static volatile int32_t SwapRetired = -1;      /* Buffer replaced by the last latch, scanned until the reload */
+static volatile uint32_t SwapPendingFence = 0; /* DMA2D work the pending buffer waits for */
+
+/* L8 palettes: the CLUT of each layer and the last color mapped to it */
+static const uint32_t *Palette[MAX_LAYER_NUMBER];
+static uint32_t PaletteSize[MAX_LAYER_NUMBER];
+static uint32_t PaletteLastColor[MAX_LAYER_NUMBER];
+static uint32_t PaletteLastIndex[MAX_LAYER_NUMBER];
+
+/* Blank glyph drawn for characters out of range or when a font atlas does not fit in
+   SDRAM; large enough for any packed font (glyphs below 32x32) */
+static const uint8_t BlankGlyph[32 * 4] = {0};
 /**
   * @}
   */ 
@@ -136,7 +202,22 @@ LCD_DrvTypeDef  *LcdDrv;
   * @{
   */ 
 static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c);
+static void DecodeGlyph(const sFONT *pFont, uint32_t Index, uint8_t *pDst);
+static void RasterizeChar(const uint8_t *c, uint32_t Dst, uint32_t Pitch, uint16_t width, uint16_t height, uint32_t TextColor, uint32_t BackColor, uint32_t Size);
+static uint32_t PixelAddress(uint32_t LayerIndex, uint16_t Xpos, uint16_t Ypos);
+static uint32_t ConvertColor(uint32_t Color, uint32_t LayerIndex);
+static uint32_t PaletteIndex(uint32_t Color, uint32_t LayerIndex);
+static void WritePixel(uint32_t Address, uint32_t Value, uint32_t Size);
+static uint32_t BlitBuffer(uint32_t Src, uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t SrcOffLine, uint32_t OffLine, uint32_t ColorMode);
+static uint32_t BlendBuffer(uint32_t Src, uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t Color, uint32_t ColorMode);
+static uint32_t QueueOperation(const LCD_Dma2dOpTypeDef *pOp);
+static void StartNextOperation(void);
+static void StartOperation(const LCD_Dma2dOpTypeDef *pOp);
+static void LCD_DMA2D_IRQHandler(void);
+static void LCD_LTDC_IRQHandler(void);
+static void BeginFrame(int32_t Source);
 static void FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex);
+static void FillBufferL8(uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint8_t Index);
 static void ConvertLineToARGB8888(void *pSrc, void *pDst, uint32_t xSize, uint32_t ColorMode);
 /**
   * @}
@@ -226,6 +307,12 @@ uint8_t BSP_LCD_Init(void)
     /* Initialize the font */
     BSP_LCD_SetFont(&LCD_DEFAULT_FONT);
 
+    /* Queued DMA2D operations are chained from the transfer complete interrupt */
+    Dma2dRegs.Valid = 0;
+    NVIC_SetPriority(DMA2D_IRQn, LCD_DMA2D_IRQ_PRIORITY);
+    NVIC_SetVector(DMA2D_IRQn, (uint32_t)LCD_DMA2D_IRQHandler);
+    NVIC_EnableIRQ(DMA2D_IRQn);
+
   return LCD_OK;
 }  
 
@@ -253,6 +340,22 @@ uint32_t BSP_LCD_GetYSize(void)
   * @param  FB_Address: the layer frame buffer.
   */
 void BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FB_Address)
+{     
+  BSP_LCD_LayerInit(LayerIndex, FB_Address, LTDC_PIXEL_FORMAT_ARGB8888);
+}
+
+/**
+  * @brief  Initializes an LCD layer with a given pixel format. Drawing
+  *         functions take ARGB8888 colors and convert them to the format.
+  * @param  LayerIndex: the layer foreground or background. 
+  * @param  FB_Address: the layer frame buffer, GetXSize * GetYSize pixels
+  *         of BSP_LCD_GetPixelSize(PixelFormat) bytes.
+  * @param  PixelFormat: LTDC_PIXEL_FORMAT_ARGB8888, LTDC_PIXEL_FORMAT_RGB888,
+  *         LTDC_PIXEL_FORMAT_RGB565, LTDC_PIXEL_FORMAT_ARGB1555,
+  *         LTDC_PIXEL_FORMAT_ARGB4444 or LTDC_PIXEL_FORMAT_L8
+  * @note   An L8 layer needs a palette (see BSP_LCD_SetPalette).
+  */
+void BSP_LCD_LayerInit(uint16_t LayerIndex, uint32_t FB_Address, uint32_t PixelFormat)
 {     
   LCD_LayerCfgTypeDef   Layercfg;
 
@@ -261,7 +364,7 @@ void BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FB_Address)
   Layercfg.WindowX1 = BSP_LCD_GetXSize();
   Layercfg.WindowY0 = 0;
   Layercfg.WindowY1 = BSP_LCD_GetYSize(); 
-  Layercfg.PixelFormat = LTDC_PIXEL_FORMAT_ARGB8888;
+  Layercfg.PixelFormat = PixelFormat;
   Layercfg.FBStartAdress = FB_Address;
   Layercfg.Alpha = 255;
   Layercfg.Alpha0 = 0;
@@ -283,6 +386,114 @@ void BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FB_Address)
   HAL_LTDC_EnableDither(&LtdcHandler);
 }
 
+/**
+  * @brief  Gets the size of one pixel.
+  * @param  PixelFormat: LTDC pixel format
+  * @retval Bytes per pixel
+  */
+uint32_t BSP_LCD_GetPixelSize(uint32_t PixelFormat)
+{
+  switch(PixelFormat)
+  {
+  case LTDC_PIXEL_FORMAT_ARGB8888:
+    return 4;
+  case LTDC_PIXEL_FORMAT_RGB888:
+    return 3;
+  case LTDC_PIXEL_FORMAT_RGB565:
+  case LTDC_PIXEL_FORMAT_ARGB1555:
+  case LTDC_PIXEL_FORMAT_ARGB4444:
+  case LTDC_PIXEL_FORMAT_AL88:
+    return 2;
+  default:
+    return 1;
+  }
+}
+
+/**
+  * @brief  Loads the color look-up table of an L8 layer. Drawing functions
+  *         map their ARGB8888 colors to the nearest palette entry.
+  * @param  LayerIndex: layer index
+  * @param  pColors: palette, Count ARGB8888 colors (alpha is ignored); it is
+  *         used for the color mapping and must stay valid
+  * @param  Count: number of colors, 1 to 256
+  */
+void BSP_LCD_SetPalette(uint32_t LayerIndex, const uint32_t *pColors, uint32_t Count)
+{
+  uint32_t i;
+
+  /* Glyphs cached with the old indexes must not be reused */
+  BSP_LCD_WaitForTransfer();
+  for(i = 0; i < LCD_GLYPH_CACHE_SLOTS; i++)
+  {
+    if(GlyphCache[i].PixelFormat == LTDC_PIXEL_FORMAT_L8)
+    {
+      GlyphCache[i].pGlyph = 0;
+    }
+  }
+
+  Palette[LayerIndex] = pColors;
+  PaletteSize[LayerIndex] = Count;
+  PaletteLastColor[LayerIndex] = pColors[0];
+  PaletteLastIndex[LayerIndex] = 0;
+
+  HAL_LTDC_ConfigCLUT(&LtdcHandler, (uint32_t *)pColors, Count, LayerIndex);
+  HAL_LTDC_EnableCLUT(&LtdcHandler, LayerIndex);
+}
+
+/**
+  * @brief  Gets the layer selected for drawing.
+  * @retval Layer index
+  */
+uint32_t BSP_LCD_GetActiveLayer(void)
+{
+  return ActiveLayer;
+}
+
+/**
+  * @brief  Gets the frame buffer drawn into on a layer: the back buffer
+  *         while a swap chain runs on it.
+  * @param  LayerIndex: layer index
+  * @retval Frame buffer address
+  */
+uint32_t BSP_LCD_GetLayerAddress(uint32_t LayerIndex)
+{
+  return LtdcHandler.LayerCfg[LayerIndex].FBStartAdress;
+}
+
+/**
+  * @brief  Gets the pixel format of a layer.
+  * @param  LayerIndex: layer index
+  * @retval LTDC pixel format
+  */
+uint32_t BSP_LCD_GetPixelFormat(uint32_t LayerIndex)
+{
+  return LtdcHandler.LayerCfg[LayerIndex].PixelFormat;
+}
+
+/**
+  * @brief  Converts an ARGB8888 color to a pixel value of a layer, for
+  *         writing into its frame buffer directly.
+  * @param  LayerIndex: layer index
+  * @param  Color: ARGB8888 color
+  * @retval Pixel value (palette index on L8 layers)
+  */
+uint32_t BSP_LCD_ConvertColor(uint32_t LayerIndex, uint32_t Color)
+{
+  return ConvertColor(Color, LayerIndex);
+}
+
+/**
+  * @brief  Gets the palette of an L8 layer.
+  * @param  LayerIndex: layer index
+  * @param  ppColors: receives the palette (see BSP_LCD_SetPalette)
+  * @retval Number of colors, 0 without a palette
+  */
+uint32_t BSP_LCD_GetPalette(uint32_t LayerIndex, const uint32_t **ppColors)
+{
+  *ppColors = Palette[LayerIndex];
+  return PaletteSize[LayerIndex];
+}
+
 /**
   * @brief  Selects the LCD Layer.
   * @param  LayerIndex: the Layer foreground or background.
@@ -412,6 +623,32 @@ void BSP_LCD_SetLayerWindow_NoReload(uint16_t LayerIndex, uint16_t Xpos, uint16_
   HAL_LTDC_SetWindowPosition_NoReload(&LtdcHandler, Xpos, Ypos, LayerIndex); 
 }
 
+/**
+  * @brief  Sets the line pitch of a layer frame buffer, so the layer can show
+  *         a window of a wider image.
+  * @note   Setting the layer address or window resets the pitch to the window
+  *         width: set the pitch after them.
+  * @param  LayerIndex: layer index
+  * @param  Pitch: pixels from the start of one line to the next
+  */
+void BSP_LCD_SetLayerPitch(uint32_t LayerIndex, uint32_t Pitch)
+{
+  HAL_LTDC_SetPitch(&LtdcHandler, Pitch, LayerIndex);
+}
+
+/**
+  * @brief  Sets the line pitch of a layer frame buffer without reloading.
+  * @note   Setting the layer address or window resets the pitch to the window
+  *         width: set the pitch after them.
+  * @param  LayerIndex: layer index
+  * @param  Pitch: pixels from the start of one line to the next
+  * @retval None
+  */
+void BSP_LCD_SetLayerPitch_NoReload(uint32_t LayerIndex, uint32_t Pitch)
+{
+  HAL_LTDC_SetPitch_NoReload(&LtdcHandler, Pitch, LayerIndex);
+}
+
 /**
   * @brief  Configures and sets the color Keying.
   * @param  LayerIndex: the Layer foreground or background
@@ -470,6 +707,18 @@ void BSP_LCD_Relaod(uint32_t ReloadType)
   HAL_LTDC_Relaod (&LtdcHandler, ReloadType);
 }
 
+/**
+  * @brief  Waits until a reload requested for the vertical blanking (by
+  *         BSP_LCD_Relaod or a presented frame) has taken place.
+  * @retval None
+  */
+void BSP_LCD_WaitForReload(void)
+{
+  while(LTDC->SRCR & LTDC_SRCR_VBR)
+  {
+  }
+}
+
 /**
   * @brief  Gets the LCD Text color.
   * @retval Text color
@@ -528,33 +777,53 @@ sFONT *BSP_LCD_GetFont(void)
   * @brief  Reads Pixel.
   * @param  Xpos: the X position
   * @param  Ypos: the Y position 
-  * @retval RGB pixel color
+  * @retval RGB pixel color (ARGB8888 for ARGB8888, RGB888, RGB565 and L8
+  *         layers, the raw pixel value otherwise)
   */
 uint32_t BSP_LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos)
 {
   uint32_t ret = 0;
+  uint32_t address;
   
+  BSP_LCD_WaitForTransfer();
+
+  address = PixelAddress(ActiveLayer, Xpos, Ypos);
+
   if(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB8888)
   {
     /* Read data value from SDRAM memory */
-    ret = *(__IO uint32_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (4*(Ypos*BSP_LCD_GetXSize() + Xpos)));
+    ret = *(__IO uint32_t*) (address);
   }
   else if(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB888)
   {
-    /* Read data value from SDRAM memory */
-    ret = (*(__IO uint32_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (4*(Ypos*BSP_LCD_GetXSize() + Xpos))) & 0x00FFFFFF);
+    /* Read data value from SDRAM memory (three bytes, blue first) */
+    ret = *(__IO uint8_t*) (address) | (*(__IO uint8_t*) (address + 1) << 8) | (*(__IO uint8_t*) (address + 2) << 16);
   }
-  else if((LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) || \
+  else if(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
+  {
+    /* Read data value from SDRAM memory and expand it to ARGB8888 */
+    ret = *(__IO uint16_t*) (address);
+    ret = 0xFF000000 | \
+          ((((ret >> 11) & 0x1F) * 255 / 31) << 16) | \
+          ((((ret >> 5) & 0x3F) * 255 / 63) << 8) | \
+          ((ret & 0x1F) * 255 / 31);
+  }
+  else if((LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB1555) || \
           (LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB4444) || \
           (LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_AL88))  
   {
     /* Read data value from SDRAM memory */
-    ret = *(__IO uint16_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (2*(Ypos*BSP_LCD_GetXSize() + Xpos)));    
+    ret = *(__IO uint16_t*) (address);    
+  }
+  else if((LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_L8) && (PaletteSize[ActiveLayer] != 0))
+  {
+    /* Read the index from SDRAM memory and look its color up */
+    ret = 0xFF000000 | Palette[ActiveLayer][*(__IO uint8_t*) (address) % PaletteSize[ActiveLayer]];
   }
   else
   {
     /* Read data value from SDRAM memory */
-    ret = *(__IO uint8_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (2*(Ypos*BSP_LCD_GetXSize() + Xpos)));    
+    ret = *(__IO uint8_t*) (address);    
   }
 
   return ret;
@@ -594,8 +863,101 @@ void BSP_LCD_ClearStringLine(uint32_t Line)
   */
 void BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii)
 {
-  DrawChar(Xpos, Ypos, &DrawProp[ActiveLayer].pFont->table[(Ascii-' ') *\
-              DrawProp[ActiveLayer].pFont->Height * ((DrawProp[ActiveLayer].pFont->Width + 7) / 8)]);
+  DrawChar(Xpos, Ypos, BSP_LCD_GetGlyph(DrawProp[ActiveLayer].pFont, Ascii));
+}
+
+/**
+  * @brief  Gets the 1-bpp bitmap of a character: rows of (Width + 7) / 8
+  *         bytes, most significant bit leftmost. A glyph of a packed font is
+  *         decoded into the font's SDRAM atlas the first time it is asked
+  *         for and read from there afterwards, so the address stays valid.
+  * @param  pFont: font
+  * @param  Ascii: character ascii code, between 0x20 and 0x7E (others give a blank)
+  * @retval Glyph address
+  */
+const uint8_t *BSP_LCD_GetGlyph(sFONT *pFont, uint8_t Ascii)
+{
+  uint32_t size = pFont->Height * ((pFont->Width + 7) / 8);
+  uint32_t index = Ascii - ' ';
+  uint32_t address;
+
+  if(index >= 95)
+  {
+    return BlankGlyph;
+  }
+
+  if(pFont->pPacked == 0)
+  {
+    return &pFont->table[index * size];
+  }
+
+  if(pFont->table == 0)
+  {
+    /* Room for every glyph; only the ones drawn are ever decoded */
+    address = BSP_SDRAM_Alloc(95 * size);
+    if(address == 0)
+    {
+      return BlankGlyph;
+    }
+    pFont->table = (const uint8_t *)address;
+  }
+
+  if((pFont->Decoded[index >> 5] & (1U << (index & 31))) == 0)
+  {
+    DecodeGlyph(pFont, index, (uint8_t *)&pFont->table[index * size]);
+    pFont->Decoded[index >> 5] |= 1U << (index & 31);
+  }
+
+  return &pFont->table[index * size];
+}
+
+/**
+  * @brief  Decodes one packed glyph (format in tools/fontpack.py): the bounding
+  *         box of its set pixels as 5-bit top, rows, left and cols fields,
+  *         then rows x cols pixel bits, most significant bit first.
+  * @param  pFont: packed font
+  * @param  Index: glyph index (character - ' ')
+  * @param  pDst: 1-bpp glyph to write, Height rows of (Width + 7) / 8 bytes
+  */
+static void DecodeGlyph(const sFONT *pFont, uint32_t Index, uint8_t *pDst)
+{
+  const uint8_t *src = pFont->pPacked + pFont->pOffsets[Index];
+  uint32_t stride = (pFont->Width + 7) / 8;
+  uint32_t bit = 0, field[4], top, rows, left, cols, x, y, i;
+
+  for(i = 0; i < stride * pFont->Height; i++)
+  {
+    pDst[i] = 0;
+  }
+
+  for(i = 0; i < 4; i++)
+  {
+    field[i] = 0;
+    for(x = 0; x < 5; x++, bit++)
+    {
+      field[i] = (field[i] << 1) | ((src[bit >> 3] >> (7 - (bit & 7))) & 1);
+    }
+    if((i == 1) && (field[1] == 0))
+    {
+      /* Blank glyph */
+      return;
+    }
+  }
+  top = field[0];
+  rows = field[1];
+  left = field[2];
+  cols = field[3];
+
+  for(y = top; y < top + rows; y++)
+  {
+    for(x = left; x < left + cols; x++, bit++)
+    {
+      if(src[bit >> 3] & (0x80 >> (bit & 7)))
+      {
+        pDst[y * stride + (x >> 3)] |= 0x80 >> (x & 7);
+      }
+    }
+  }
 }
 
 /**
@@ -658,6 +1020,169 @@ void BSP_LCD_DisplayStringAt(uint16_t X, uint16_t Y, uint8_t *pText, Text_AlignM
   }  
 }
 
+/**
+  * @brief  Builds an anti-aliased A8 font from a 1-bpp font. Each output pixel
+  *         covers Scale x Scale source pixels and its alpha is the fraction of
+  *         them that are set, so Font24 with Scale 2 gives smooth 9x12 text.
+  *         The alpha table is allocated in SDRAM.
+  * @param  pSource: 1-bpp source font
+  * @param  Scale: source pixels per output pixel in each direction (1 to 4)
+  * @param  pFont: font to fill in
+  * @retval LCD status (LCD_ERROR if Scale is out of range or SDRAM is full)
+  */
+uint8_t BSP_LCD_CreateFontA8(sFONT *pSource, uint16_t Scale, sFONTA8 *pFont)
+{
+  uint32_t width, height, bytes, address;
+  uint32_t ch, x, y, i, j, count;
+  const uint8_t *pchar, *prow;
+  uint8_t *palpha;
+
+  if((Scale < 1) || (Scale > 4))
+  {
+    return LCD_ERROR;
+  }
+
+  width = (pSource->Width + Scale - 1) / Scale;
+  height = (pSource->Height + Scale - 1) / Scale;
+  bytes = (pSource->Width + 7) / 8;
+
+  address = BSP_SDRAM_Alloc(95 * width * height);
+  if(address == 0)
+  {
+    return LCD_ERROR;
+  }
+  palpha = (uint8_t *)address;
+
+  for(ch = 0; ch < 95; ch++)
+  {
+    pchar = BSP_LCD_GetGlyph(pSource, ' ' + ch);
+    for(y = 0; y < height; y++)
+    {
+      for(x = 0; x < width; x++)
+      {
+        /* Count the set source pixels inside the box (clipped at the glyph border) */
+        count = 0;
+        for(i = y * Scale; (i < (y + 1) * Scale) && (i < pSource->Height); i++)
+        {
+          prow = pchar + i * bytes;
+          for(j = x * Scale; (j < (x + 1) * Scale) && (j < pSource->Width); j++)
+          {
+            if(prow[j >> 3] & (0x80 >> (j & 7)))
+            {
+              count++;
+            }
+          }
+        }
+        *palpha++ = (uint8_t)((count * 255) / (Scale * Scale));
+      }
+    }
+  }
+
+  pFont->table = (const uint8_t *)address;
+  pFont->Width = width;
+  pFont->Height = height;
+
+  return LCD_OK;
+}
+
+/**
+  * @brief  Blends one A8 character over the frame buffer in the text color.
+  *         The background is kept, so text can be drawn over charts.
+  * @param  Xpos: start column address
+  * @param  Ypos: the Line where to display the character shape
+  * @param  pFont: A8 font (see BSP_LCD_CreateFontA8)
+  * @param  Ascii: character ascii code, must be between 0x20 and 0x7E
+  */
+void BSP_LCD_DisplayCharA8(uint16_t Xpos, uint16_t Ypos, sFONTA8 *pFont, uint8_t Ascii)
+{
+  uint32_t xsize = BSP_LCD_GetXSize();
+  uint32_t size = pFont->Width * pFont->Height;
+  uint32_t textcolor = DrawProp[ActiveLayer].TextColor;
+  const uint8_t *alpha;
+  uint32_t i, j, a, back, color;
+  uint8_t *pixel;
+
+  if((Ascii < ' ') || (Ascii > '~') || (Xpos + pFont->Width > xsize) || (Ypos + pFont->Height > BSP_LCD_GetYSize()))
+  {
+    return;
+  }
+
+  if(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_L8)
+  {
+    /* The DMA2D cannot write L8: blend with the CPU through the palette */
+    if(PaletteSize[ActiveLayer] == 0)
+    {
+      return;
+    }
+    BSP_LCD_WaitForTransfer();
+    alpha = pFont->table + (Ascii - ' ') * size;
+    for(i = 0; i < pFont->Height; i++)
+    {
+      pixel = (uint8_t *)PixelAddress(ActiveLayer, Xpos, Ypos + i);
+      for(j = 0; j < pFont->Width; j++, alpha++, pixel++)
+      {
+        a = *alpha * ((textcolor >> 24) & 0xFF) / 255;
+        if(a == 0)
+        {
+          continue;
+        }
+        back = Palette[ActiveLayer][*pixel % PaletteSize[ActiveLayer]];
+        color = ((((textcolor >> 16) & 0xFF) * a + ((back >> 16) & 0xFF) * (255 - a)) / 255) << 16 | \
+                ((((textcolor >> 8) & 0xFF) * a + ((back >> 8) & 0xFF) * (255 - a)) / 255) << 8 | \
+                (((textcolor & 0xFF) * a + (back & 0xFF) * (255 - a)) / 255);
+        *pixel = (uint8_t)PaletteIndex(0xFF000000 | color, ActiveLayer);
+      }
+    }
+    return;
+  }
+
+  BlendBuffer((uint32_t)pFont->table + (Ascii - ' ') * size,
+              PixelAddress(ActiveLayer, Xpos, Ypos),
+              pFont->Width, pFont->Height, xsize - pFont->Width,
+              textcolor, LtdcHandler.LayerCfg[ActiveLayer].PixelFormat);
+}
+
+/**
+  * @brief  Displays a string in an A8 font, blended over the frame buffer.
+  * @param  X: x position (in pixel)
+  * @param  Y: y position (in pixel)
+  * @param  pFont: A8 font (see BSP_LCD_CreateFontA8)
+  * @param  pText: pointer to string to display on LCD
+  * @param  mode: The display mode (CENTER_MODE, RIGHT_MODE or LEFT_MODE)
+  */
+void BSP_LCD_DisplayStringAtA8(uint16_t X, uint16_t Y, sFONTA8 *pFont, uint8_t *pText, Text_AlignModeTypdef mode)
+{
+  uint16_t refcolumn = X;
+  uint32_t size = 0, xsize = 0;
+  uint8_t  *ptr = pText;
+
+  /* Get the text size */
+  while (*ptr++) size ++ ;
+
+  /* Characters number per line */
+  xsize = (BSP_LCD_GetXSize()/pFont->Width);
+
+  if(size < xsize)
+  {
+    if(mode == CENTER_MODE)
+    {
+      refcolumn = X + ((xsize - size) * pFont->Width) / 2;
+    }
+    else if(mode == RIGHT_MODE)
+    {
+      refcolumn = X + ((xsize - size) * pFont->Width);
+    }
+  }
+
+  /* Send the string character by character, stopping at the right edge */
+  while ((*pText != 0) && (refcolumn + pFont->Width <= BSP_LCD_GetXSize()))
+  {
+    BSP_LCD_DisplayCharA8(refcolumn, Y, pFont, *pText);
+    refcolumn += pFont->Width;
+    pText++;
+  }
+}
+
 /**
   * @brief  Displays a maximum of 20 char on the LCD.
   * @param  Line: the Line where to display the character shape
@@ -679,7 +1204,7 @@ void BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
   uint32_t xaddress = 0;
   
   /* Get the line address */
-  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
+  xaddress = PixelAddress(ActiveLayer, Xpos, Ypos);
 
   /* Write line */
   FillBuffer(ActiveLayer, (uint32_t *)xaddress, Length, 1, 0, DrawProp[ActiveLayer].TextColor);
@@ -696,7 +1221,7 @@ void BSP_LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
   uint32_t xaddress = 0;
   
   /* Get the line address */
-  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
+  xaddress = PixelAddress(ActiveLayer, Xpos, Ypos);
   
   /* Write line */
   FillBuffer(ActiveLayer, (uint32_t *)xaddress, 1, Length, (BSP_LCD_GetXSize() - 1), DrawProp[ActiveLayer].TextColor);
@@ -897,6 +1422,7 @@ void BSP_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
   * @param  X: the bmp x position in the LCD
   * @param  Y: the bmp Y position in the LCD
   * @param  pBmp: Bmp picture address in the internal Flash
+  * @note   Not supported on L8 layers: the DMA2D cannot convert to indexes.
   */
 void BSP_LCD_DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp)
 {
@@ -904,6 +1430,11 @@ void BSP_LCD_DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp)
   uint32_t address;
   uint32_t inputcolormode = 0;
   
+  if(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_L8)
+  {
+    return;
+  }
+
   /* Get bitmap data address offset */
   index = pBmp[10] + (pBmp[11] << 8) + (pBmp[12] << 16)  + (pBmp[13] << 24);
 
@@ -917,7 +1448,7 @@ void BSP_LCD_DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp)
   bitpixel = pBmp[28] + (pBmp[29] << 8);   
  
   /* Set Address */
-  address = LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (((BSP_LCD_GetXSize()*Y) + X)*(4));
+  address = PixelAddress(ActiveLayer, X, Y);
 
   /* Get the Layer pixel format */    
   if ((bitpixel/8) == 4)
@@ -936,16 +1467,19 @@ void BSP_LCD_DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp)
   /* bypass the bitmap header */
   pBmp += (index + (width * (height - 1) * (bitpixel/8)));
 
-  /* Convert picture to ARGB8888 pixel format */
+  /* Convert picture to the layer pixel format */
   for(index=0; index < height; index++)
   {
   /* Pixel format conversion */
   ConvertLineToARGB8888((uint32_t *)pBmp, (uint32_t *)address, width, inputcolormode);
 
   /* Increment the source and destination buffers */
-  address+=  ((BSP_LCD_GetXSize() - width + width)*4);
+  address+=  (BSP_LCD_GetXSize()*BSP_LCD_GetPixelSize(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat));
   pBmp -= width*(bitpixel/8);
   }
+
+  /* The lines are converted from the caller's buffer: finish before returning */
+  BSP_LCD_WaitForTransfer();
 }
 
 /**
@@ -963,12 +1497,30 @@ void BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Hei
   BSP_LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
 
   /* Get the rectangle start address */
-  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
+  xaddress = PixelAddress(ActiveLayer, Xpos, Ypos);
 
   /* Fill the rectangle */
   FillBuffer(ActiveLayer, (uint32_t *)xaddress, Width, Height, (BSP_LCD_GetXSize() - Width), DrawProp[ActiveLayer].TextColor);
 }
 
+/**
+  * @brief  Copies a block of pixels into the active layer with the DMA2D.
+  *         The source is in the layer's pixel format and is read when the
+  *         copy runs, so keep it unchanged until the fence is done.
+  * @param  Src: address of the first source pixel
+  * @param  SrcPitch: source pixels from the start of one line to the next
+  * @param  Xpos: the X position
+  * @param  Ypos: the Y position
+  * @param  Width: block width
+  * @param  Height: block height
+  * @retval Fence of the copy
+  */
+uint32_t BSP_LCD_CopyRect(uint32_t Src, uint32_t SrcPitch, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  return BlitBuffer(Src, PixelAddress(ActiveLayer, Xpos, Ypos), Width, Height, SrcPitch - Width,
+                    BSP_LCD_GetXSize() - Width, LtdcHandler.LayerCfg[ActiveLayer].PixelFormat);
+}
+
 /**
   * @brief  Displays a full circle.
   * @param  Xpos: the X position
@@ -1307,8 +1859,118 @@ __weak void BSP_LCD_MspInit(void)
   */
 void BSP_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code)
 {
+  /* Do not race queued DMA2D writes */
+  BSP_LCD_WaitForTransfer();
+
   /* Write data value to all SDRAM memory */
-  *(__IO uint32_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (4*(Ypos*BSP_LCD_GetXSize() + Xpos))) = RGB_Code;
+  WritePixel(PixelAddress(ActiveLayer, Xpos, Ypos),
+             ConvertColor(RGB_Code, ActiveLayer),
+             BSP_LCD_GetPixelSize(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat));
+}
+
+/**
+  * @brief  Gets the address of a pixel of a layer.
+  * @param  LayerIndex: layer index
+  * @param  Xpos: the X position
+  * @param  Ypos: the Y position
+  * @retval Pixel address
+  */
+static uint32_t PixelAddress(uint32_t LayerIndex, uint16_t Xpos, uint16_t Ypos)
+{
+  return LtdcHandler.LayerCfg[LayerIndex].FBStartAdress + \
+         BSP_LCD_GetPixelSize(LtdcHandler.LayerCfg[LayerIndex].PixelFormat) * (Ypos*BSP_LCD_GetXSize() + Xpos);
+}
+
+/**
+  * @brief  Converts an ARGB8888 color to the pixel format of a layer.
+  * @param  Color: ARGB8888 color
+  * @param  LayerIndex: layer index
+  * @retval Pixel value
+  */
+static uint32_t ConvertColor(uint32_t Color, uint32_t LayerIndex)
+{
+  switch(LtdcHandler.LayerCfg[LayerIndex].PixelFormat)
+  {
+  case LTDC_PIXEL_FORMAT_RGB888:
+    return Color & 0x00FFFFFF;
+  case LTDC_PIXEL_FORMAT_RGB565:
+    return ((Color >> 8) & 0xF800) | ((Color >> 5) & 0x07E0) | ((Color >> 3) & 0x001F);
+  case LTDC_PIXEL_FORMAT_ARGB1555:
+    return ((Color >> 16) & 0x8000) | ((Color >> 9) & 0x7C00) | ((Color >> 6) & 0x03E0) | ((Color >> 3) & 0x001F);
+  case LTDC_PIXEL_FORMAT_ARGB4444:
+    return ((Color >> 16) & 0xF000) | ((Color >> 12) & 0x0F00) | ((Color >> 8) & 0x00F0) | ((Color >> 4) & 0x000F);
+  case LTDC_PIXEL_FORMAT_L8:
+    return PaletteIndex(Color, LayerIndex);
+  default:
+    return Color;
+  }
+}
+
+/**
+  * @brief  Finds the palette entry nearest to a color. The last result is
+  *         kept, so runs of pixels in one color search only once.
+  * @param  Color: ARGB8888 color (alpha is ignored)
+  * @param  LayerIndex: L8 layer index
+  * @retval Palette index, 0 without a palette
+  */
+static uint32_t PaletteIndex(uint32_t Color, uint32_t LayerIndex)
+{
+  uint32_t i, best = 0, bestdist = 0xFFFFFFFF, dist;
+  int32_t dr, dg, db;
+
+  Color &= 0x00FFFFFF;
+  if(PaletteSize[LayerIndex] == 0)
+  {
+    return 0;
+  }
+  if(Color == (PaletteLastColor[LayerIndex] & 0x00FFFFFF))
+  {
+    return PaletteLastIndex[LayerIndex];
+  }
+
+  for(i = 0; (i < PaletteSize[LayerIndex]) && (bestdist != 0); i++)
+  {
+    dr = (int32_t)((Color >> 16) & 0xFF) - (int32_t)((Palette[LayerIndex][i] >> 16) & 0xFF);
+    dg = (int32_t)((Color >> 8) & 0xFF) - (int32_t)((Palette[LayerIndex][i] >> 8) & 0xFF);
+    db = (int32_t)(Color & 0xFF) - (int32_t)(Palette[LayerIndex][i] & 0xFF);
+    dist = dr*dr + dg*dg + db*db;
+    if(dist < bestdist)
+    {
+      bestdist = dist;
+      best = i;
+    }
+  }
+
+  PaletteLastColor[LayerIndex] = Color;
+  PaletteLastIndex[LayerIndex] = best;
+  return best;
+}
+
+/**
+  * @brief  Writes one pixel value.
+  * @param  Address: pixel address
+  * @param  Value: pixel value in the layer format
+  * @param  Size: bytes per pixel
+  */
+static void WritePixel(uint32_t Address, uint32_t Value, uint32_t Size)
+{
+  switch(Size)
+  {
+  case 4:
+    *(__IO uint32_t*) (Address) = Value;
+    break;
+  case 3:
+    *(__IO uint8_t*) (Address) = (uint8_t)Value;
+    *(__IO uint8_t*) (Address + 1) = (uint8_t)(Value >> 8);
+    *(__IO uint8_t*) (Address + 2) = (uint8_t)(Value >> 16);
+    break;
+  case 2:
+    *(__IO uint16_t*) (Address) = (uint16_t)Value;
+    break;
+  default:
+    *(__IO uint8_t*) (Address) = (uint8_t)Value;
+    break;
+  }
 }
 
 /**
@@ -1318,16 +1980,70 @@ void BSP_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code)
   * @param  c: pointer to the character data
   */
 static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
+{
+  uint16_t height = DrawProp[ActiveLayer].pFont->Height;
+  uint16_t width  = DrawProp[ActiveLayer].pFont->Width;
+  uint32_t textcolor = DrawProp[ActiveLayer].TextColor;
+  uint32_t backcolor = DrawProp[ActiveLayer].BackColor;
+  uint32_t format = LtdcHandler.LayerCfg[ActiveLayer].PixelFormat;
+  uint32_t size = BSP_LCD_GetPixelSize(format);
+  uint32_t xsize = BSP_LCD_GetXSize();
+  uint32_t dst = PixelAddress(ActiveLayer, Xpos, Ypos);
+  uint32_t slot, src;
+
+  /* Reserve the cache in SDRAM on first use */
+  if(GlyphCacheState == 0)
+  {
+    GlyphCacheAddress = BSP_SDRAM_Alloc(LCD_GLYPH_CACHE_SLOTS * LCD_GLYPH_SLOT_SIZE);
+    GlyphCacheState = (GlyphCacheAddress != 0) ? 1 : 2;
+  }
+
+  if((GlyphCacheState != 1) || ((uint32_t)width * height * size > LCD_GLYPH_SLOT_SIZE) || (c == BlankGlyph))
+  {
+    /* No cache (the blank glyph is shared by all font sizes): draw straight into the frame buffer */
+    BSP_LCD_WaitForTransfer();
+    RasterizeChar(c, dst, xsize * size, width, height, ConvertColor(textcolor, ActiveLayer), ConvertColor(backcolor, ActiveLayer), size);
+    return;
+  }
+
+  /* Direct-mapped slot from the glyph bitmap address and the colors */
+  slot = (uint32_t)c ^ (textcolor * 0x9E3779B1) ^ (backcolor * 0x85EBCA77) ^ format;
+  slot = (slot ^ (slot >> 16)) % LCD_GLYPH_CACHE_SLOTS;
+  src = GlyphCacheAddress + slot * LCD_GLYPH_SLOT_SIZE;
+
+  if((GlyphCache[slot].pGlyph != c) || (GlyphCache[slot].TextColor != textcolor) || (GlyphCache[slot].BackColor != backcolor) || (GlyphCache[slot].PixelFormat != format))
+  {
+    /* Miss: rasterize once into the slot, after the queued blits that still read it */
+    BSP_LCD_WaitForFence(GlyphCache[slot].Fence);
+    RasterizeChar(c, src, width * size, width, height, ConvertColor(textcolor, ActiveLayer), ConvertColor(backcolor, ActiveLayer), size);
+    GlyphCache[slot].pGlyph = c;
+    GlyphCache[slot].TextColor = textcolor;
+    GlyphCache[slot].BackColor = backcolor;
+    GlyphCache[slot].PixelFormat = format;
+  }
+
+  /* Copy the glyph into place; the transfer runs on while the CPU prepares the next one */
+  GlyphCache[slot].Fence = BlitBuffer(src, dst, width, height, 0, xsize - width, format);
+}
+
+/**
+  * @brief  Expands a 1-bpp font character into pixels.
+  * @param  c: pointer to the character data
+  * @param  Dst: address of the first destination pixel
+  * @param  Pitch: destination bytes per line
+  * @param  width: character width
+  * @param  height: character height
+  * @param  TextColor: pixel value of the set bits
+  * @param  BackColor: pixel value of the clear bits
+  * @param  Size: bytes per pixel
+  */
+static void RasterizeChar(const uint8_t *c, uint32_t Dst, uint32_t Pitch, uint16_t width, uint16_t height, uint32_t TextColor, uint32_t BackColor, uint32_t Size)
 {
   uint32_t i = 0, j = 0;
-  uint16_t height, width;
   uint8_t offset;
   uint8_t *pchar;
   uint32_t line=0;
 
-  height = DrawProp[ActiveLayer].pFont->Height;
-  width  = DrawProp[ActiveLayer].pFont->Width;
-
   offset = 8 *((width + 7)/8) -  width ;
 
   for(i = 0; i < height; i++)
@@ -1354,17 +2070,77 @@ static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
     {
       if(line & (1 << (width- j + offset- 1))) 
       {
-        BSP_LCD_DrawPixel((Xpos + j), Ypos, DrawProp[ActiveLayer].TextColor);
+        WritePixel(Dst + j*Size, TextColor, Size);
       }
       else
       {
-        BSP_LCD_DrawPixel((Xpos + j), Ypos, DrawProp[ActiveLayer].BackColor);
+        WritePixel(Dst + j*Size, BackColor, Size);
       } 
     }
-    Ypos++;
+    Dst += Pitch;
   }
 }
 
+/**
+  * @brief  Queues a DMA2D copy of pixels.
+  * @param  Src: address of the first source pixel
+  * @param  Dst: address of the first destination pixel
+  * @param  xSize: width in pixels
+  * @param  ySize: height in lines
+  * @param  SrcOffLine: source pixels skipped between lines
+  * @param  OffLine: destination pixels skipped between lines
+  * @param  ColorMode: pixel format of source and destination
+  * @retval Fence of the copy
+  */
+static uint32_t BlitBuffer(uint32_t Src, uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t SrcOffLine, uint32_t OffLine, uint32_t ColorMode)
+{
+  LCD_Dma2dOpTypeDef op;
+
+  /* A plain copy sizes its pixels from the foreground mode; L8 is no valid output mode */
+  op.Mode = DMA2D_M2M;
+  op.InputColorMode = ColorMode;
+  op.OutputColorMode = (ColorMode == CM_L8) ? CM_ARGB8888 : ColorMode;
+  op.Src = Src;
+  op.Dst = Dst;
+  op.Width = xSize;
+  op.Height = ySize;
+  op.OffLine = OffLine;
+  op.SrcOffLine = SrcOffLine;
+  op.Color = 0;
+
+  return QueueOperation(&op);
+}
+
+/**
+  * @brief  Queues a DMA2D blend of an A8 alpha mask in a fixed color over
+  *         frame buffer pixels.
+  * @param  Src: address of the alpha mask (contiguous lines)
+  * @param  Dst: address of the first destination pixel (also the background)
+  * @param  xSize: width in pixels
+  * @param  ySize: height in lines
+  * @param  OffLine: destination pixels skipped between lines
+  * @param  Color: ARGB8888 color of the mask
+  * @param  ColorMode: pixel format of the destination
+  * @retval Fence of the blend
+  */
+static uint32_t BlendBuffer(uint32_t Src, uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t Color, uint32_t ColorMode)
+{
+  LCD_Dma2dOpTypeDef op;
+
+  op.Mode = DMA2D_M2M_BLEND;
+  op.InputColorMode = CM_A8;
+  op.OutputColorMode = ColorMode;
+  op.Src = Src;
+  op.Dst = Dst;
+  op.Width = xSize;
+  op.Height = ySize;
+  op.OffLine = OffLine;
+  op.SrcOffLine = 0;
+  op.Color = Color;
+
+  return QueueOperation(&op);
+}
+
 /**
   * @brief  Fills buffer.
   * @param  LayerIndex: layer index
@@ -1376,30 +2152,94 @@ static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
   */
 static void FillBuffer(uint32_t LayerIndex, void * pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex) 
 {
-  
-  /* Register to memory mode with ARGB8888 as color Mode */ 
-  Dma2dHandler.Init.Mode         = DMA2D_R2M;
-  Dma2dHandler.Init.ColorMode    = DMA2D_ARGB8888;
-  Dma2dHandler.Init.OutputOffset = OffLine;      
-  
-  Dma2dHandler.Instance = DMA2D; 
-  
-  /* DMA2D Initialization */
-  if(HAL_DMA2D_Init(&Dma2dHandler) == HAL_OK) 
+  LCD_Dma2dOpTypeDef op;
+
+  if(LtdcHandler.LayerCfg[LayerIndex].PixelFormat == LTDC_PIXEL_FORMAT_L8)
   {
-    if(HAL_DMA2D_ConfigLayer(&Dma2dHandler, LayerIndex) == HAL_OK) 
+    FillBufferL8((uint32_t)pDst, xSize, ySize, OffLine, (uint8_t)ConvertColor(ColorIndex, LayerIndex));
+    return;
+  }
+
+  /* Register to memory mode in the layer pixel format */ 
+  op.Mode = DMA2D_R2M;
+  op.InputColorMode = CM_ARGB8888;
+  op.OutputColorMode = LtdcHandler.LayerCfg[LayerIndex].PixelFormat;
+  op.Src = ConvertColor(ColorIndex, LayerIndex);
+  op.Dst = (uint32_t)pDst;
+  op.Width = xSize;
+  op.Height = ySize;
+  op.OffLine = OffLine;
+  op.SrcOffLine = 0;
+  op.Color = 0;
+
+  QueueOperation(&op);
+}
+
+/**
+  * @brief  Fills an L8 buffer. The DMA2D has no 8-bit output mode, so pixel
+  *         pairs on even addresses are filled as RGB565 pixels holding the
+  *         index twice; an odd first or last column is written by the CPU.
+  * @param  Dst: address of the first pixel
+  * @param  xSize: buffer width
+  * @param  ySize: buffer height
+  * @param  OffLine: offset
+  * @param  Index: palette index
+  */
+static void FillBufferL8(uint32_t Dst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint8_t Index)
+{
+  LCD_Dma2dOpTypeDef op;
+  uint32_t pitch = xSize + OffLine;
+  uint32_t head = Dst & 1;
+  uint32_t pairs = (xSize - head) / 2;
+  uint32_t tail = xSize - head - 2 * pairs;
+  uint32_t x, y;
+
+  if((pitch & 1) || (xSize <= head))
+  {
+    /* Lines alternate in alignment: no pairs */
+    head = xSize;
+    pairs = 0;
+    tail = 0;
+  }
+
+  if(head || tail)
+  {
+    /* The CPU writes after the queued operations that may cover these pixels */
+    BSP_LCD_WaitForTransfer();
+    for(y = 0; y < ySize; y++)
     {
-      if (HAL_DMA2D_Start(&Dma2dHandler, ColorIndex, (uint32_t)pDst, xSize, ySize) == HAL_OK)
+      for(x = 0; x < head; x++)
       {
-        /* Polling For DMA transfer */  
-        HAL_DMA2D_PollForTransfer(&Dma2dHandler, 10);
+        *(__IO uint8_t*) (Dst + y * pitch + x) = Index;
+      }
+      if(tail)
+      {
+        *(__IO uint8_t*) (Dst + y * pitch + xSize - 1) = Index;
       }
     }
-  } 
+  }
+
+  if(pairs == 0)
+  {
+    return;
+  }
+
+  op.Mode = DMA2D_R2M;
+  op.InputColorMode = CM_ARGB8888;
+  op.OutputColorMode = CM_RGB565;
+  op.Src = Index | (Index << 8);
+  op.Dst = Dst + head;
+  op.Width = pairs;
+  op.Height = ySize;
+  op.OffLine = pitch / 2 - pairs;
+  op.SrcOffLine = 0;
+  op.Color = 0;
+
+  QueueOperation(&op);
 }
 
 /**
-  * @brief  Converts Line to ARGB8888 pixel format.
+  * @brief  Converts Line to the pixel format of the active layer.
   * @param  pSrc: pointer to source buffer
   * @param  pDst: output color
   * @param  xSize: buffer width
@@ -1407,31 +2247,362 @@ static void FillBuffer(uint32_t LayerIndex, void * pDst, uint32_t xSize, uint32_
   */
 static void ConvertLineToARGB8888(void * pSrc, void * pDst, uint32_t xSize, uint32_t ColorMode)
 {    
-  /* Configure the DMA2D Mode, Color Mode and output offset */
-  Dma2dHandler.Init.Mode         = DMA2D_M2M_PFC;
-  Dma2dHandler.Init.ColorMode    = DMA2D_ARGB8888;
-  Dma2dHandler.Init.OutputOffset = 0;     
-  
-  /* Foreground Configuration */
-  Dma2dHandler.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
-  Dma2dHandler.LayerCfg[1].InputAlpha = 0xFF;
-  Dma2dHandler.LayerCfg[1].InputColorMode = ColorMode;
-  Dma2dHandler.LayerCfg[1].InputOffset = 0;
-  
-  Dma2dHandler.Instance = DMA2D; 
-  
-  /* DMA2D Initialization */
-  if(HAL_DMA2D_Init(&Dma2dHandler) == HAL_OK) 
+  LCD_Dma2dOpTypeDef op;
+
+  /* Memory to memory with pixel format conversion */
+  op.Mode = DMA2D_M2M_PFC;
+  op.InputColorMode = ColorMode;
+  op.OutputColorMode = LtdcHandler.LayerCfg[ActiveLayer].PixelFormat;
+  op.Src = (uint32_t)pSrc;
+  op.Dst = (uint32_t)pDst;
+  op.Width = xSize;
+  op.Height = 1;
+  op.OffLine = 0;
+  op.SrcOffLine = 0;
+  op.Color = 0;
+
+  QueueOperation(&op);
+}
+
+/**
+  * @brief  Adds an operation to the DMA2D queue, starting it at once when the
+  *         DMA2D is idle. Waits only while the queue is full.
+  * @param  pOp: operation to copy into the queue
+  * @retval Fence of the operation
+  */
+static uint32_t QueueOperation(const LCD_Dma2dOpTypeDef *pOp)
+{
+  uint32_t primask;
+
+  /* Wait for a free entry; the interrupt drains the queue */
+  while((Dma2dQueued - Dma2dCompleted) >= LCD_DMA2D_QUEUE_SIZE)
+  {
+    BSP_LCD_WaitForFence(Dma2dCompleted + 1);
+  }
+
+  Dma2dQueue[Dma2dQueued % LCD_DMA2D_QUEUE_SIZE] = *pOp;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  Dma2dQueued++;
+  if(Dma2dStarted == Dma2dCompleted)
+  {
+    /* DMA2D idle: nothing left to chain from, start here */
+    StartNextOperation();
+  }
+  __set_PRIMASK(primask);
+
+  return Dma2dQueued;
+}
+
+/**
+  * @brief  Starts the oldest queued operation that was not started yet.
+  *         Called with the DMA2D interrupt masked or from it.
+  */
+static void StartNextOperation(void)
+{
+  if(Dma2dStarted != Dma2dQueued)
+  {
+    Dma2dStarted++;
+    StartOperation(&Dma2dQueue[(Dma2dStarted - 1) % LCD_DMA2D_QUEUE_SIZE]);
+  }
+}
+
+/**
+  * @brief  Programs the DMA2D registers for one operation and starts it with
+  *         the transfer complete and error interrupts enabled. Only addresses,
+  *         size and the fill color are written every time; the offsets and the
+  *         layer configuration are written when they differ from the previous
+  *         operation. The output color mode is the destination layer's
+  *         pixel format (the DMA2D and LTDC use the same numbering for it).
+  *         A configuration error raises an interrupt like a completed transfer,
+  *         so every started operation is retired by LCD_DMA2D_IRQHandler.
+  * @param  pOp: operation
+  */
+static void StartOperation(const LCD_Dma2dOpTypeDef *pOp)
+{
+  uint32_t fgpfccr;
+
+  if(!Dma2dRegs.Valid)
+  {
+    /* First operation: load every register the queue relies on */
+    DMA2D->OPFCCR = Dma2dRegs.OPFCCR = pOp->OutputColorMode;
+    DMA2D->FGOR = Dma2dRegs.FGOR = pOp->SrcOffLine;
+    DMA2D->BGPFCCR = Dma2dRegs.BGPFCCR = pOp->OutputColorMode;
+    DMA2D->OOR = Dma2dRegs.OOR = pOp->OffLine;
+    DMA2D->BGOR = Dma2dRegs.BGOR = pOp->OffLine;
+    DMA2D->FGPFCCR = Dma2dRegs.FGPFCCR = CM_ARGB8888;
+    DMA2D->FGCOLR = Dma2dRegs.FGCOLR = 0;
+    Dma2dRegs.Valid = 1;
+  }
+
+  if(pOp->OutputColorMode != Dma2dRegs.OPFCCR)
+  {
+    DMA2D->OPFCCR = Dma2dRegs.OPFCCR = pOp->OutputColorMode;
+  }
+
+  if(pOp->OffLine != Dma2dRegs.OOR)
+  {
+    DMA2D->OOR = Dma2dRegs.OOR = pOp->OffLine;
+  }
+
+  if(pOp->Mode == DMA2D_R2M)
+  {
+    DMA2D->OCOLR = pOp->Src;
+  }
+  else
   {
-    if(HAL_DMA2D_ConfigLayer(&Dma2dHandler, 1) == HAL_OK) 
+    /* Foreground: A8 masks take their RGB from FGCOLR and combine their alpha with the color's */
+    if(pOp->Mode == DMA2D_M2M_BLEND)
     {
-      if (HAL_DMA2D_Start(&Dma2dHandler, (uint32_t)pSrc, (uint32_t)pDst, xSize, 1) == HAL_OK)
+      fgpfccr = pOp->InputColorMode | (DMA2D_COMBINE_ALPHA << 16) | (pOp->Color & 0xFF000000);
+      if((pOp->Color & 0x00FFFFFF) != Dma2dRegs.FGCOLR)
       {
-        /* Polling For DMA transfer */  
-        HAL_DMA2D_PollForTransfer(&Dma2dHandler, 10);
+        DMA2D->FGCOLR = Dma2dRegs.FGCOLR = pOp->Color & 0x00FFFFFF;
       }
+      if(pOp->OutputColorMode != Dma2dRegs.BGPFCCR)
+      {
+        DMA2D->BGPFCCR = Dma2dRegs.BGPFCCR = pOp->OutputColorMode;
+      }
+      if(pOp->OffLine != Dma2dRegs.BGOR)
+      {
+        DMA2D->BGOR = Dma2dRegs.BGOR = pOp->OffLine;
+      }
+      DMA2D->BGMAR = pOp->Dst;
     }
-  } 
+    else
+    {
+      fgpfccr = pOp->InputColorMode | (DMA2D_NO_MODIF_ALPHA << 16) | 0xFF000000;
+    }
+    if(fgpfccr != Dma2dRegs.FGPFCCR)
+    {
+      DMA2D->FGPFCCR = Dma2dRegs.FGPFCCR = fgpfccr;
+    }
+    if(pOp->SrcOffLine != Dma2dRegs.FGOR)
+    {
+      DMA2D->FGOR = Dma2dRegs.FGOR = pOp->SrcOffLine;
+    }
+    DMA2D->FGMAR = pOp->Src;
+  }
+
+  DMA2D->OMAR = pOp->Dst;
+  DMA2D->NLR = (pOp->Width << 16) | pOp->Height;
+  DMA2D->CR = pOp->Mode | DMA2D_CR_TCIE | DMA2D_CR_TEIE | DMA2D_CR_CEIE | DMA2D_CR_START;
+}
+
+/**
+  * @brief  DMA2D interrupt handler: retires the finished (or failed) operation
+  *         and starts the next queued one.
+  */
+static void LCD_DMA2D_IRQHandler(void)
+{
+  uint32_t flags = DMA2D->ISR & (DMA2D_ISR_TCIF | DMA2D_ISR_TEIF | DMA2D_ISR_CEIF);
+
+  if(flags != 0)
+  {
+    /* The clear flags sit at the same positions as the status flags */
+    DMA2D->IFCR = flags;
+    Dma2dCompleted++;
+    StartNextOperation();
+  }
+}
+
+/**
+  * @brief  Returns the fence of the most recently queued DMA2D operation.
+  *         Once it is done, everything drawn before the call is in memory.
+  * @retval Fence
+  */
+uint32_t BSP_LCD_GetFence(void)
+{
+  return Dma2dQueued;
+}
+
+/**
+  * @brief  Tells whether the DMA2D operations up to a fence have finished.
+  * @param  Fence: fence from BSP_LCD_GetFence
+  * @retval 1 when done, 0 otherwise
+  */
+uint8_t BSP_LCD_IsFenceDone(uint32_t Fence)
+{
+  /* Signed difference survives the counters wrapping */
+  return ((int32_t)(Dma2dCompleted - Fence) >= 0) ? 1 : 0;
+}
+
+/**
+  * @brief  Waits until the DMA2D operations up to a fence have finished.
+  * @param  Fence: fence from BSP_LCD_GetFence
+  */
+void BSP_LCD_WaitForFence(uint32_t Fence)
+{
+  while(!BSP_LCD_IsFenceDone(Fence))
+  {
+    if(__get_PRIMASK())
+    {
+      /* Interrupts masked: service the DMA2D from here */
+      LCD_DMA2D_IRQHandler();
+    }
+  }
+}
+
+/**
+  * @brief  Waits until every queued DMA2D operation has finished.
+  */
+void BSP_LCD_WaitForTransfer(void)
+{
+  BSP_LCD_WaitForFence(Dma2dQueued);
+}
+
+/**
+  * @brief  Switches a layer to presented frames. Drawing then goes to a back
+  *         buffer that only appears on screen, whole, after BSP_LCD_Present.
+  *         The first buffer is shown at once with the current layer content.
+  *         With three buffers neither drawing nor presenting waits for the
+  *         display; with two, presenting waits for the previous frame to be
+  *         on screen.
+  * @note   While the chain runs, the layer address in the LTDC handle is the
+  *         back buffer, so avoid the other layer settings on this layer.
+  * @param  LayerIndex: layer index
+  * @param  pBuffers: addresses of Count frame buffers of the layer size and format
+  * @param  Count: number of buffers (2 or 3)
+  * @retval LCD status
+  */
+uint8_t BSP_LCD_SwapChainInit(uint32_t LayerIndex, const uint32_t *pBuffers, uint32_t Count)
+{
+  uint32_t i, current;
+
+  if((Count < 2) || (Count > LCD_SWAP_BUFFERS_MAX) || (SwapCount != 0))
+  {
+    return LCD_ERROR;
+  }
+
+  for(i = 0; i < Count; i++)
+  {
+    SwapBuffers[i] = pBuffers[i];
+  }
+  SwapLayer = LayerIndex;
+
+  /* Move the current content into the first buffer and show it */
+  current = LtdcHandler.LayerCfg[LayerIndex].FBStartAdress;
+  if(current != SwapBuffers[0])
+  {
+    BlitBuffer(current, SwapBuffers[0], BSP_LCD_GetXSize(), BSP_LCD_GetYSize(), 0, 0, LtdcHandler.LayerCfg[LayerIndex].PixelFormat);
+    BSP_LCD_WaitForTransfer();
+    BSP_LCD_SetLayerAddress(LayerIndex, SwapBuffers[0]);
+  }
+  SwapFront = 0;
+  SwapPending = -1;
+  SwapRetired = -1;
+  SwapCount = Count;
+
+  /* Frames are latched from the line interrupt on the last active line */
+  LTDC->LIPCR = LtdcHandler.Init.AccumulatedActiveH;
+  NVIC_SetPriority(LTDC_IRQn, LCD_LTDC_IRQ_PRIORITY);
+  NVIC_SetVector(LTDC_IRQn, (uint32_t)LCD_LTDC_IRQHandler);
+  NVIC_EnableIRQ(LTDC_IRQn);
+
+  BeginFrame(0);
+
+  return LCD_OK;
+}
+
+/**
+  * @brief  Presents the back buffer: it replaces the screen content at the
+  *         next vertical blanking after the DMA2D work drawn into it is done.
+  *         A newer frame presented before that replaces it. Drawing continues
+  *         in another buffer, starting from a copy of the presented frame.
+  */
+void BSP_LCD_Present(void)
+{
+  int32_t presented = SwapBack;
+  uint32_t primask;
+
+  if(SwapCount == 0)
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  SwapPending = presented;
+  SwapPendingFence = BSP_LCD_GetFence();
+  LTDC->IER |= LTDC_IER_LIE;
+  __set_PRIMASK(primask);
+
+  BeginFrame(presented);
+}
+
+/**
+  * @brief  Tells whether a swap chain runs: layer settings written without
+  *         reloading are then latched with the next presented frame.
+  * @retval 1 after a successful BSP_LCD_SwapChainInit, 0 otherwise
+  */
+uint8_t BSP_LCD_IsPresenting(void)
+{
+  return (SwapCount != 0) ? 1 : 0;
+}
+
+/**
+  * @brief  Selects a back buffer that is neither on screen nor presented and
+  *         queues a copy of the newest frame into it.
+  * @param  Source: buffer holding the newest frame
+  */
+static void BeginFrame(int32_t Source)
+{
+  int32_t i, front, pending, back = -1;
+  uint32_t primask;
+
+  while(back < 0)
+  {
+    /* Both read together: the line interrupt moves the pending buffer to the front */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    front = SwapFront;
+    pending = SwapPending;
+    __set_PRIMASK(primask);
+
+    /* Only with two buffers can there be none free (until the pending one is latched) */
+    for(i = 0; i < (int32_t)SwapCount; i++)
+    {
+      if((i != front) && (i != pending))
+      {
+        back = i;
+        break;
+      }
+    }
+  }
+
+  /* The buffer taken off screen is scanned until the reload, which clears VBR */
+  while((back == SwapRetired) && (LTDC->SRCR & LTDC_SRCR_VBR))
+  {
+  }
+
+  SwapBack = back;
+  BlitBuffer(SwapBuffers[Source], SwapBuffers[back], BSP_LCD_GetXSize(), BSP_LCD_GetYSize(), 0, 0, LtdcHandler.LayerCfg[SwapLayer].PixelFormat);
+  LtdcHandler.LayerCfg[SwapLayer].FBStartAdress = SwapBuffers[back];
+}
+
+/**
+  * @brief  LTDC interrupt handler: on the last active line, latches the
+  *         presented buffer once its DMA2D work is done. The new address is
+  *         written to the shadow register, as BSP_LCD_SetLayerAddress_NoReload
+  *         does (without the HAL lock, which an interrupt cannot take), and
+  *         reloaded at the vertical blanking that follows the line.
+  */
+static void LCD_LTDC_IRQHandler(void)
+{
+  if(LTDC->ISR & LTDC_ISR_LIF)
+  {
+    LTDC->ICR = LTDC_ICR_CLIF;
+    if((SwapPending >= 0) && BSP_LCD_IsFenceDone(SwapPendingFence))
+    {
+      LTDC_LAYER(&LtdcHandler, SwapLayer)->CFBAR = SwapBuffers[SwapPending];
+      LTDC->SRCR = LTDC_SRCR_VBR;
+      SwapRetired = SwapFront;
+      SwapFront = SwapPending;
+      SwapPending = -1;
+      LTDC->IER &= ~LTDC_IER_LIE;
+    }
+  }
 }
 
 /**
@@ -157,6 +157,24 @@ typedef enum
 #define LCD_BACKGROUND_LAYER     0x0000
 #define LCD_FOREGROUND_LAYER     0x0001
 
+/** 
+  * @brief  LCD glyph cache (rasterized glyphs in SDRAM, drawn with DMA2D)
+  */ 
+#define LCD_GLYPH_CACHE_SLOTS    128             /* Direct-mapped cache entries */
+#define LCD_GLYPH_SLOT_SIZE      (17 * 24 * 4)   /* Largest glyph (Font24) in ARGB8888 */
+
+/** 
+  * @brief  LCD DMA2D operation queue
+  */ 
+#define LCD_DMA2D_QUEUE_SIZE     16              /* Operations queued before drawing calls wait */
+#define LCD_DMA2D_IRQ_PRIORITY   0x0F            /* Transfer complete interrupt priority */
+
+/** 
+  * @brief  LCD swap chain (frames presented at vertical blanking)
+  */ 
+#define LCD_SWAP_BUFFERS_MAX     3               /* Buffers in a swap chain */
+#define LCD_LTDC_IRQ_PRIORITY    0x0F            /* Line interrupt priority */
+
 /**
   * @}
   */ 
@@ -188,6 +206,14 @@ uint32_t BSP_LCD_GetYSize(void);
 
 /* functions using the LTDC controller */
 void     BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FrameBuffer);
+void     BSP_LCD_LayerInit(uint16_t LayerIndex, uint32_t FrameBuffer, uint32_t PixelFormat);
+uint32_t BSP_LCD_GetPixelSize(uint32_t PixelFormat);
+void     BSP_LCD_SetPalette(uint32_t LayerIndex, const uint32_t *pColors, uint32_t Count);
+uint32_t BSP_LCD_GetActiveLayer(void);
+uint32_t BSP_LCD_GetLayerAddress(uint32_t LayerIndex);
+uint32_t BSP_LCD_GetPixelFormat(uint32_t LayerIndex);
+uint32_t BSP_LCD_ConvertColor(uint32_t LayerIndex, uint32_t Color);
+uint32_t BSP_LCD_GetPalette(uint32_t LayerIndex, const uint32_t **ppColors);
 void     BSP_LCD_SetTransparency(uint32_t LayerIndex, uint8_t Transparency);
 void     BSP_LCD_SetTransparency_NoReload(uint32_t LayerIndex, uint8_t Transparency);
 void     BSP_LCD_SetLayerAddress(uint32_t LayerIndex, uint32_t Address);
@@ -198,10 +224,13 @@ void     BSP_LCD_ResetColorKeying(uint32_t LayerIndex);
 void     BSP_LCD_ResetColorKeying_NoReload(uint32_t LayerIndex);
 void     BSP_LCD_SetLayerWindow(uint16_t LayerIndex, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 void     BSP_LCD_SetLayerWindow_NoReload(uint16_t LayerIndex, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void     BSP_LCD_SetLayerPitch(uint32_t LayerIndex, uint32_t Pitch);
+void     BSP_LCD_SetLayerPitch_NoReload(uint32_t LayerIndex, uint32_t Pitch);
 void     BSP_LCD_SelectLayer(uint32_t LayerIndex);
 void     BSP_LCD_SetLayerVisible(uint32_t LayerIndex, FunctionalState state);
 void     BSP_LCD_SetLayerVisible_NoReload(uint32_t LayerIndex, FunctionalState State);
 void     BSP_LCD_Relaod(uint32_t ReloadType);
+void     BSP_LCD_WaitForReload(void);
 
 void     BSP_LCD_SetTextColor(uint32_t Color);
 void     BSP_LCD_SetBackColor(uint32_t Color);
@@ -217,6 +246,17 @@ void     BSP_LCD_ClearStringLine(uint32_t Line);
 void     BSP_LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr);
 void     BSP_LCD_DisplayStringAt(uint16_t X, uint16_t Y, uint8_t *pText, Text_AlignModeTypdef mode);
 void     BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii);
+const uint8_t *BSP_LCD_GetGlyph(sFONT *pFont, uint8_t Ascii);
+void     BSP_LCD_WaitForTransfer(void);
+uint32_t BSP_LCD_GetFence(void);
+uint8_t  BSP_LCD_IsFenceDone(uint32_t Fence);
+void     BSP_LCD_WaitForFence(uint32_t Fence);
+uint8_t  BSP_LCD_SwapChainInit(uint32_t LayerIndex, const uint32_t *pBuffers, uint32_t Count);
+void     BSP_LCD_Present(void);
+uint8_t  BSP_LCD_IsPresenting(void);
+uint8_t  BSP_LCD_CreateFontA8(sFONT *pSource, uint16_t Scale, sFONTA8 *pFont);
+void     BSP_LCD_DisplayCharA8(uint16_t Xpos, uint16_t Ypos, sFONTA8 *pFont, uint8_t Ascii);
+void     BSP_LCD_DisplayStringAtA8(uint16_t X, uint16_t Y, sFONTA8 *pFont, uint8_t *pText, Text_AlignModeTypdef mode);
 
 void     BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length);
 void     BSP_LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length);
@@ -228,6 +268,7 @@ void     BSP_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius);
 void     BSP_LCD_DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp);
 
 void     BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+uint32_t BSP_LCD_CopyRect(uint32_t Src, uint32_t SrcPitch, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 void     BSP_LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
 void     BSP_LCD_FillTriangle(uint16_t X1, uint16_t X2, uint16_t X3, uint16_t Y1, uint16_t Y2, uint16_t Y3);
 void     BSP_LCD_FillPolygon(pPoint Points, uint16_t PointCount);
@@ -79,6 +79,7 @@
 static SDRAM_HandleTypeDef SdramHandle;
 static FMC_SDRAM_TimingTypeDef Timing;
 static FMC_SDRAM_CommandTypeDef Command;
+static uint32_t SdramHeapNext = SDRAM_HEAP_ADDR;
 /**
   * @}
   */ 
@@ -315,6 +316,27 @@ void BSP_SDRAM_DMA_IRQHandler(void)
   HAL_DMA_IRQHandler(SdramHandle.hdma); 
 }
 
+/**
+  * @brief  Reserves a block of SDRAM for the application.
+  * @note   Blocks are never released; they are meant for buffers that live as
+  *         long as the application (frame buffers, caches, history rings).
+  * @param  uwSize: Size of the block in bytes
+  * @retval Start address of the block, aligned on SDRAM_HEAP_ALIGN bytes,
+  *         or 0 if the SDRAM is exhausted
+  */
+uint32_t BSP_SDRAM_Alloc(uint32_t uwSize)
+{
+  uint32_t address = (SdramHeapNext + SDRAM_HEAP_ALIGN - 1) & ~(SDRAM_HEAP_ALIGN - 1);
+  
+  if(uwSize > (SDRAM_DEVICE_ADDR + SDRAM_DEVICE_SIZE - address))
+  {
+    return 0;
+  }
+  
+  SdramHeapNext = address + uwSize;
+  return address;
+}
+
 /**
   * @brief  Initializes SDRAM MSP.
   * @note   This function can be surcharged by application code.
@@ -79,6 +79,13 @@
   */   
 #define SDRAM_DEVICE_ADDR         ((uint32_t)0xD0000000)
 #define SDRAM_DEVICE_SIZE         ((uint32_t)0x800000)  /* SDRAM device size in Bytes */
+
+/**
+  * @brief  SDRAM heap used by BSP_SDRAM_Alloc(): everything above the layer 1 frame
+  *         buffer (240x320 ARGB8888); the layer 0 frame buffers are allocated from it
+  */
+#define SDRAM_HEAP_ADDR           ((uint32_t)(SDRAM_DEVICE_ADDR + 0x4B000))
+#define SDRAM_HEAP_ALIGN          ((uint32_t)32)        /* Block alignment in Bytes (one SDRAM burst) */
   
 /**
   * @brief  FMC SDRAM Memory Width
@@ -157,6 +164,7 @@ uint8_t           BSP_SDRAM_WriteData(uint32_t uwStartAddress, uint32_t* pData,
 uint8_t           BSP_SDRAM_WriteData_DMA(uint32_t uwStartAddress, uint32_t* pData, uint32_t uwDataSize);
 uint8_t           BSP_SDRAM_Sendcmd(FMC_SDRAM_CommandTypeDef *SdramCmd);
 void              BSP_SDRAM_DMA_IRQHandler(void);
+uint32_t          BSP_SDRAM_Alloc(uint32_t uwSize);
 
 /* These function can be modified in case the current settings (e.g. DMA stream)
    need to be changed for specific application needs */
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""Compress the 1-bpp LCD fonts into Fonts/fonts_packed.c.
+
+Each glyph is cropped to the bounding box of its set pixels and stored as a
+bit stream, most significant bit first, starting on a byte boundary:
+
+    5 bits  top    first row of the box
+    5 bits  rows   box height (0 for a blank glyph, which ends here)
+    5 bits  left   first column of the box
+    5 bits  cols   box width
+    rows x cols    pixels, row by row
+
+FontN_Offsets[c] is the byte offset of glyph ' ' + c in FontN_Packed.
+BSP_LCD_GetGlyph() decodes a glyph into the font's SDRAM atlas the first
+time it is drawn.
+
+Usage: python3 tools/fontpack.py   (from the repository root)
+"""
+
+import os
+import re
+import sys
+
+FONTS_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "Embedded Challenge", "Fonts")
+SIZES = (8, 12, 16, 20, 24)
+GLYPHS = 95  # ' ' to '~'
+FIELD_BITS = 5
+
+
+def parse_font(path):
+    """Return (table bytes, width, height) of a fontN.c file."""
+    text = open(path, newline="").read()
+    body = re.search(r"_Table\s*\[\]\s*=\s*\{(.*?)\};", text, re.S).group(1)
+    body = re.sub(r"//[^\n]*", "", body)
+    body = re.sub(r"/\*.*?\*/", "", body, flags=re.S)
+    table = [int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]+", body)]
+    width = int(re.search(r"(\d+),\s*/\*\s*Width", text).group(1))
+    height = int(re.search(r"(\d+),\s*/\*\s*Height", text).group(1))
+    return table, width, height
+
+
+def glyph_rows(table, width, height, index):
+    """Rows of one glyph as integers, bit width - 1 being the leftmost pixel."""
+    stride = (width + 7) // 8
+    base = index * height * stride
+    rows = []
+    for y in range(height):
+        value = 0
+        for b in range(stride):
+            value = (value << 8) | table[base + y * stride + b]
+        rows.append(value >> (stride * 8 - width))
+    return rows
+
+
+class BitWriter:
+    def __init__(self):
+        self.bytes = []
+        self.count = 0
+
+    def write(self, value, bits):
+        for i in range(bits - 1, -1, -1):
+            if self.count % 8 == 0:
+                self.bytes.append(0)
+            if (value >> i) & 1:
+                self.bytes[-1] |= 0x80 >> (self.count % 8)
+            self.count += 1
+
+
+def pack_glyph(rows, width):
+    out = BitWriter()
+    ink = [y for y, row in enumerate(rows) if row]
+    if not ink:
+        out.write(0, FIELD_BITS)
+        out.write(0, FIELD_BITS)
+        return out.bytes
+
+    top, bottom = ink[0], ink[-1] + 1
+    union = 0
+    for row in rows:
+        union |= row
+    columns = [x for x in range(width) if (union >> (width - 1 - x)) & 1]
+    left, right = columns[0], columns[-1] + 1
+
+    out.write(top, FIELD_BITS)
+    out.write(bottom - top, FIELD_BITS)
+    out.write(left, FIELD_BITS)
+    out.write(right - left, FIELD_BITS)
+    for row in rows[top:bottom]:
+        for x in range(left, right):
+            out.write((row >> (width - 1 - x)) & 1, 1)
+    return out.bytes
+
+
+def unpack_glyph(data, offset, width, height):
+    """Reference decoder, used to check every glyph round-trips."""
+    position = [offset * 8]
+
+    def read(bits):
+        value = 0
+        for _ in range(bits):
+            byte = data[position[0] >> 3]
+            value = (value << 1) | ((byte >> (7 - (position[0] & 7))) & 1)
+            position[0] += 1
+        return value
+
+    rows = [0] * height
+    top = read(FIELD_BITS)
+    count = read(FIELD_BITS)
+    if count == 0:
+        return rows
+    left = read(FIELD_BITS)
+    cols = read(FIELD_BITS)
+    for y in range(top, top + count):
+        for x in range(left, left + cols):
+            if read(1):
+                rows[y] |= 1 << (width - 1 - x)
+    return rows
+
+
+def format_bytes(values, indent="  ", per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join("0x%02X" % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    out = []
+    out.append("/* Compressed LCD fonts, generated by tools/fontpack.py from Fonts/font8.c to font24.c: do not edit.")
+    out.append("   Glyph format: see tools/fontpack.py. Linked instead of the plain tables when FONTS_PACKED is 1. */")
+    out.append("")
+    out.append('#include "fonts.h"')
+    out.append("")
+    out.append("#if FONTS_PACKED")
+
+    raw_total = packed_total = 0
+    for size in SIZES:
+        table, width, height = parse_font(os.path.join(FONTS_DIR, "font%d.c" % size))
+        stride = (width + 7) // 8
+        if len(table) != GLYPHS * height * stride or width >= 1 << FIELD_BITS or height >= 1 << FIELD_BITS:
+            sys.exit("font%d.c: unexpected table size" % size)
+
+        packed = []
+        offsets = []
+        for index in range(GLYPHS):
+            rows = glyph_rows(table, width, height, index)
+            offsets.append(len(packed))
+            packed.extend(pack_glyph(rows, width))
+            if unpack_glyph(packed, offsets[-1], width, height) != rows:
+                sys.exit("font%d.c: glyph %d does not round-trip" % (size, index))
+
+        raw_total += len(table)
+        packed_total += len(packed) + 2 * GLYPHS
+        out.append("")
+        out.append("/* Font%d: %dx%d, %d bytes packed (%d plain) */" % (size, width, height, len(packed) + 2 * GLYPHS, len(table)))
+        out.append("static const uint8_t Font%d_Packed[] =" % size)
+        out.append("{")
+        out.append(format_bytes(packed))
+        out.append("};")
+        out.append("")
+        out.append("static const uint16_t Font%d_Offsets[%d] =" % (size, GLYPHS))
+        out.append("{")
+        for i in range(0, GLYPHS, 12):
+            out.append("  " + ", ".join("%d" % v for v in offsets[i:i + 12]) + ",")
+        out.append("};")
+        out.append("")
+        out.append("sFONT Font%d = {" % size)
+        out.append("  0, /* Decoded on first use */")
+        out.append("  %d, /* Width */" % width)
+        out.append("  %d, /* Height */" % height)
+        out.append("  Font%d_Packed," % size)
+        out.append("  Font%d_Offsets," % size)
+        out.append("};")
+
+    out.append("")
+    out.append("#endif /* FONTS_PACKED */")
+    out.append("")
+
+    with open(os.path.join(FONTS_DIR, "fonts_packed.c"), "w", newline="\n") as f:
+        f.write("\n".join(out))
+    print("%d bytes plain, %d bytes packed" % (raw_total, packed_total))
+
+
+if __name__ == "__main__":
+    main()